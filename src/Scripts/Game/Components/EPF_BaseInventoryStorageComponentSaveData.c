@@ -1,6 +1,8 @@
 [EPF_ComponentSaveDataType(BaseInventoryStorageComponent), BaseContainerProps()]
 class EPF_BaseInventoryStorageComponentSaveDataClass : EPF_ComponentSaveDataClass
 {
+	[Attribute(defvalue: "0", desc: "Store items without nested entities that are identical apart from their id (e.g. full magazines in a supply crate) as one entry with a list of slots and ids.")]
+	bool m_bCollapseIdenticalItems;
 };
 
 [EDF_DbName.Automatic()]
@@ -9,6 +11,7 @@ class EPF_BaseInventoryStorageComponentSaveData : EPF_ComponentSaveData
 	int m_iPriority;
 	EStoragePurpose m_ePurposeFlags;
 	ref array<ref EPF_PersistentInventoryStorageSlot> m_aSlots;
+	ref array<ref EPF_PersistentInventoryStorageSlotGroup> m_aSlotGroups;
 
 	//------------------------------------------------------------------------------------------------
 	override EPF_EReadResult ReadFrom(IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes)
@@ -17,34 +20,52 @@ class EPF_BaseInventoryStorageComponentSaveData : EPF_ComponentSaveData
 
 		m_iPriority = storageComponent.GetPriority();
 		m_ePurposeFlags = storageComponent.GetPurpose();
-		m_aSlots = {};
+		if (m_aSlots)
+		{
+			m_aSlots.Clear();
+		}
+		else
+		{
+			m_aSlots = {};
+		}
+
+		if (m_aSlotGroups)
+			m_aSlotGroups.Clear();
+
+		// Slots of items that can be collapsed into groups if identical
+		array<int> collapsibleSlots;
+		if (EPF_BaseInventoryStorageComponentSaveDataClass.Cast(attributes).m_bCollapseIdenticalItems)
+			collapsibleSlots = {};
+
+		// Baked storage changes along the parent slot chain are the same for every slot, so only resolve them once if needed
+		int parentSlotChangeState = -1;
+
+		EPF_BakedStorageChanges storageChanges = EPF_BakedStorageChange.GetAll(storageComponent);
+
+		EPF_PersistenceComponent persistence = EPF_Component<EPF_PersistenceComponent>.Find(owner);
+		bool baked = EPF_BitFlags.CheckFlags(persistence.GetFlags(), EPF_EPersistenceFlags.BAKED);
+
+		bool bakedParent = true;
+		EPF_PersistenceComponent parentPersistence = persistence.GetParentPersistence();
+		if (parentPersistence)
+			bakedParent = EPF_BitFlags.CheckFlags(parentPersistence.GetFlags(), EPF_EPersistenceFlags.BAKED);
 
 		for (int nSlot = 0, slots = storageComponent.GetSlotsCount(); nSlot < slots; nSlot++)
 		{
 			IEntity slotEntity = storageComponent.Get(nSlot);
 			ResourceName prefab = EPF_Utils.GetPrefabName(slotEntity);
-			EPF_BakedStorageChange slotChange = EPF_BakedStorageChange.Get(storageComponent, nSlot);
-			EPF_PersistenceComponent slotPersistence = EPF_Component<EPF_PersistenceComponent>.Find(slotEntity);
-
-			EPF_PersistenceComponent persistence = EPF_Component<EPF_PersistenceComponent>.Find(owner);
-			bool baked = EPF_BitFlags.CheckFlags(persistence.GetFlags(), EPF_EPersistenceFlags.BAKED);
-
-			bool bakedParent = true;
-			IEntity parent = owner.GetParent();
-			if (parent)
-			{
-				EPF_PersistenceComponent parentPersistence = EPF_Component<EPF_PersistenceComponent>.Find(parent);
-				if (parentPersistence)
-					bakedParent = EPF_BitFlags.CheckFlags(parentPersistence.GetFlags(), EPF_EPersistenceFlags.BAKED);
-			}
+			EPF_BakedStorageChange slotChange;
+			if (storageChanges)
+				slotChange = storageChanges.Get(nSlot);
 
+			EPF_PersistenceComponent slotPersistence = EPF_Component<EPF_PersistenceComponent>.Find(slotEntity);
 			if (!slotPersistence)
 			{
 				// Item on slot that has no persistece component needs to be explictly removed or else on load there would be nothing removing it
 				// Also remove if slot is now empty but a slot change was recorded (can only be a removal then)
 				if (baked && bakedParent && (slotEntity || slotChange))
 				{
-					EPF_PersistentInventoryStorageSlot persistentSlot();
+					EPF_PersistentInventoryStorageSlot persistentSlot = EPF_PersistentInventoryStorageSlot.Cast(EPF_SaveDataPool.Get(EPF_PersistentInventoryStorageSlot));
 					persistentSlot.m_iSlotIndex = nSlot;
 					m_aSlots.Insert(persistentSlot);
 				}
@@ -68,39 +89,146 @@ class EPF_BaseInventoryStorageComponentSaveData : EPF_ComponentSaveData
 				!slotChange)
 			{
 				// Double check parent slot that there is no baked storage change detected
-				bool canSkip = true;
-				InventoryStorageSlot parentSlot = storageComponent.GetParentSlot();
-				while (parentSlot)
+				if (parentSlotChangeState == -1)
 				{
-					if (EPF_BakedStorageChange.Has(parentSlot.GetStorage(), parentSlot.GetID()))
-					{
-						canSkip = false;
-						break;
-					}
-
-					BaseInventoryStorageComponent storage = parentSlot.GetStorage();
-					if (!storage)
-						break;
-
-					parentSlot = storage.GetParentSlot();
+					parentSlotChangeState = 0;
+					if (HasBakedParentSlotChange(storageComponent))
+						parentSlotChangeState = 1;
 				}
 
-				if (canSkip)
+				if (parentSlotChangeState == 0)
+				{
+					EPF_SaveDataPool.Release(saveData);
 					continue;
+				}
 			}
 
-			EPF_PersistentInventoryStorageSlot persistentSlot();
+			EPF_PersistentInventoryStorageSlot persistentSlot = EPF_PersistentInventoryStorageSlot.Cast(EPF_SaveDataPool.Get(EPF_PersistentInventoryStorageSlot));
 			persistentSlot.m_iSlotIndex = nSlot;
 			persistentSlot.m_pEntity = saveData;
-			m_aSlots.Insert(persistentSlot);
+			int slotIdx = m_aSlots.Insert(persistentSlot);
+
+			// Only items without nested entities, as their ids would be lost
+			if (collapsibleSlots && !slotEntity.GetChildren())
+				collapsibleSlots.Insert(slotIdx);
 		}
 
-		if (m_aSlots.IsEmpty() && !EPF_StorageChangeDetection.IsDirty(storageComponent))
+		if (collapsibleSlots && collapsibleSlots.Count() > 1)
+			CollapseIdenticalSlots(collapsibleSlots);
+
+		if (m_aSlots.IsEmpty() && (!m_aSlotGroups || m_aSlotGroups.IsEmpty()) && !EPF_StorageChangeDetection.IsDirty(storageComponent))
 			return EPF_EReadResult.DEFAULT;
 
 		return EPF_EReadResult.OK;
 	}
 
+	//------------------------------------------------------------------------------------------------
+	//! Move slots holding identical items into slot groups.
+	//! \param candidates indices into m_aSlots of slots holding items that can be collapsed
+	protected void CollapseIdenticalSlots(notnull array<int> candidates)
+	{
+		// Match each candidate only against the first slot of every distinct item found so far
+		array<int> distinctSlots();
+		array<ref array<int>> identicalSlots();
+		foreach (int slotIdx : candidates)
+		{
+			EPF_EntitySaveData saveData = m_aSlots.Get(slotIdx).m_pEntity;
+
+			bool matched;
+			foreach (int distinctIdx, int distinctSlotIdx : distinctSlots)
+			{
+				EPF_EntitySaveData distinctSaveData = m_aSlots.Get(distinctSlotIdx).m_pEntity;
+				if (distinctSaveData.m_rPrefab == saveData.m_rPrefab &&
+					distinctSaveData.Type() == saveData.Type() &&
+					distinctSaveData.Equals(saveData))
+				{
+					identicalSlots.Get(distinctIdx).Insert(slotIdx);
+					matched = true;
+					break;
+				}
+			}
+
+			if (!matched)
+			{
+				distinctSlots.Insert(slotIdx);
+				identicalSlots.Insert({slotIdx});
+			}
+		}
+
+		set<int> collapsedSlots();
+		foreach (array<int> slotIndices : identicalSlots)
+		{
+			if (slotIndices.Count() < 2)
+				continue;
+
+			EPF_PersistentInventoryStorageSlotGroup slotGroup = EPF_PersistentInventoryStorageSlotGroup.Cast(EPF_SaveDataPool.Get(EPF_PersistentInventoryStorageSlotGroup));
+			if (!slotGroup.m_aSlotIndices)
+			{
+				slotGroup.m_aSlotIndices = {};
+				slotGroup.m_aIds = {};
+			}
+
+			slotGroup.m_aSlotIndices.Reserve(slotIndices.Count());
+			slotGroup.m_aIds.Reserve(slotIndices.Count());
+
+			foreach (int slotIdx : slotIndices)
+			{
+				EPF_PersistentInventoryStorageSlot persistentSlot = m_aSlots.Get(slotIdx);
+				slotGroup.m_aSlotIndices.Insert(persistentSlot.m_iSlotIndex);
+				slotGroup.m_aIds.Insert(persistentSlot.m_pEntity.GetId());
+
+				// The first item is kept as template for all others
+				if (!slotGroup.m_pEntity)
+				{
+					slotGroup.m_pEntity = persistentSlot.m_pEntity;
+				}
+				else
+				{
+					EPF_SaveDataPool.Release(persistentSlot.m_pEntity);
+				}
+
+				persistentSlot.m_pEntity = null;
+				collapsedSlots.Insert(slotIdx);
+			}
+
+			if (!m_aSlotGroups)
+				m_aSlotGroups = {};
+
+			m_aSlotGroups.Insert(slotGroup);
+		}
+
+		// Remove back to front so the remaining indices stay valid
+		for (int slotIdx = m_aSlots.Count() - 1; slotIdx >= 0; slotIdx--)
+		{
+			if (!collapsedSlots.Contains(slotIdx))
+				continue;
+
+			EPF_PersistentInventoryStorageSlot persistentSlot = m_aSlots.Get(slotIdx);
+			m_aSlots.RemoveOrdered(slotIdx);
+			EPF_SaveDataPool.Return(persistentSlot);
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Check the parent slot chain of the storage for any recorded baked storage change.
+	protected static bool HasBakedParentSlotChange(notnull BaseInventoryStorageComponent storageComponent)
+	{
+		InventoryStorageSlot parentSlot = storageComponent.GetParentSlot();
+		while (parentSlot)
+		{
+			BaseInventoryStorageComponent storage = parentSlot.GetStorage();
+			if (!storage)
+				break;
+
+			if (EPF_BakedStorageChange.Has(storage, parentSlot.GetID()))
+				return true;
+
+			parentSlot = storage.GetParentSlot();
+		}
+
+		return false;
+	}
+
 	//------------------------------------------------------------------------------------------------
 	override bool IsFor(IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes)
 	{
@@ -112,10 +240,11 @@ class EPF_BaseInventoryStorageComponentSaveData : EPF_ComponentSaveData
 	override EPF_EApplyResult ApplyTo(IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes)
 	{
 		BaseInventoryStorageComponent storageComponent = BaseInventoryStorageComponent.Cast(component);
-		InventoryStorageManagerComponent storageManager = InventoryStorageManagerComponent.Cast(owner.FindComponent(InventoryStorageManagerComponent));
+		EPF_PersistenceComponent persistence = EPF_Component<EPF_PersistenceComponent>.Find(owner);
+		InventoryStorageManagerComponent storageManager = persistence.GetStorageManager();
 		if (!storageManager) storageManager = EPF_GlobalInventoryStorageManagerComponent.GetInstance();
 
-		bool isNotBaked = !EPF_BitFlags.CheckFlags(EPF_Component<EPF_PersistenceComponent>.Find(owner).GetFlags(), EPF_EPersistenceFlags.BAKED);
+		bool isNotBaked = !EPF_BitFlags.CheckFlags(persistence.GetFlags(), EPF_EPersistenceFlags.BAKED);
 		set<int> processedSlots;
 		if (isNotBaked)
 			processedSlots = new set<int>();
@@ -125,80 +254,104 @@ class EPF_BaseInventoryStorageComponentSaveData : EPF_ComponentSaveData
 			if (isNotBaked)
 				processedSlots.Insert(slot.m_iSlotIndex);
 
-			IEntity slotEntity = storageComponent.Get(slot.m_iSlotIndex);
+			if (ApplySlot(owner, storageComponent, storageManager, isNotBaked, slot.m_iSlotIndex, slot.m_pEntity) == EPF_EApplyResult.ERROR)
+				return EPF_EApplyResult.ERROR;
+		}
 
-			// Found matching entity, no need to spawn, just apply save-data
-			if (slot.m_pEntity &&
-				slotEntity &&
-				EPF_Utils.GetPrefabName(slotEntity).StartsWith(slot.m_pEntity.m_rPrefab))
+		if (m_aSlotGroups)
+		{
+			foreach (EPF_PersistentInventoryStorageSlotGroup slotGroup : m_aSlotGroups)
 			{
-				EPF_PersistenceComponent slotPersistence = EPF_Component<EPF_PersistenceComponent>.Find(slotEntity);
-				if (slotPersistence && !slotPersistence.Load(slot.m_pEntity, false))
-					return EPF_EApplyResult.ERROR;
+				foreach (int memberIdx, int slotIndex : slotGroup.m_aSlotIndices)
+				{
+					if (isNotBaked)
+						processedSlots.Insert(slotIndex);
 
-				continue;
+					if (ApplySlot(owner, storageComponent, storageManager, isNotBaked, slotIndex, slotGroup.GetEntity(memberIdx)) == EPF_EApplyResult.ERROR)
+						return EPF_EApplyResult.ERROR;
+				}
 			}
+		}
 
-			EPF_PersistenceComponent persistence = EPF_Component<EPF_PersistenceComponent>.Find(owner);
-			if (EPF_BitFlags.CheckFlags(persistence.GetFlags(), EPF_EPersistenceFlags.BAKED))
+		// Delte any items not found in the storage data for non bakes that always save all slots
+		if (isNotBaked)
+		{
+			for (int nSlot = 0, count = storageComponent.GetSlotsCount(); nSlot < count; nSlot++)
 			{
-				EPF_BakedStorageChange change();
-				if (slotEntity)
-				{
-					EPF_PersistenceComponent slotPersistence = EPF_Component<EPF_PersistenceComponent>.Find(slotEntity);
-					if (!slotPersistence)
-					{
-						// Non persistence slot removals can only be overridden by dynamic entity placed into them
-						change.m_sRemovedItemId = "PERMANENT_BAKED_REMOVAL";
-					}
-					else
-					{
-						// Remember slot removals
-						change.m_sRemovedItemId = slotPersistence.GetPersistentId();
-					}
-
-				}
-				else
+				if (!processedSlots.Contains(nSlot))
 				{
-					// Remember slot replacement on baked entities
-					change.m_bReplaced = true;
+					IEntity slotEntity = storageComponent.Get(nSlot);
+					if (slotEntity && slotEntity.FindComponent(EPF_PersistenceComponent))
+						storageManager.TryDeleteItem(slotEntity);
 				}
-
-				EPF_BakedStorageChange.Set(storageComponent, slot.m_iSlotIndex, change);
 			}
+		}
 
-			// Slot did not match save-data, delete current entity on it
-			storageManager.TryDeleteItem(slotEntity);
+		return EPF_EApplyResult.OK;
+	}
 
-			if (!slot.m_pEntity)
-				continue;
+	//------------------------------------------------------------------------------------------------
+	//! Apply the item save-data to a storage slot, replacing the current item if it does not match.
+	protected EPF_EApplyResult ApplySlot(IEntity owner, BaseInventoryStorageComponent storageComponent, InventoryStorageManagerComponent storageManager, bool isNotBaked, int slotIndex, EPF_EntitySaveData saveData)
+	{
+		IEntity slotEntity = storageComponent.Get(slotIndex);
 
-			// Spawn new entity and attach it
-			slotEntity = slot.m_pEntity.Spawn(false);
-			if (!slotEntity)
+		// Found matching entity, no need to spawn, just apply save-data
+		if (saveData &&
+			slotEntity &&
+			EPF_Utils.GetPrefabName(slotEntity).StartsWith(saveData.m_rPrefab))
+		{
+			EPF_PersistenceComponent slotPersistence = EPF_Component<EPF_PersistenceComponent>.Find(slotEntity);
+			if (slotPersistence && !slotPersistence.Load(saveData, false))
 				return EPF_EApplyResult.ERROR;
 
-			// Teleport to target position so it is within valid range and if insert fails becomes visible overflow
-			EPF_WorldUtils.Teleport(slotEntity, owner.GetOrigin(), owner.GetYawPitchRoll()[0]);
-
-			// Unable to add it to the storage parent, so put it on the ground at the parent origin
-			storageManager.TryInsertItemInStorage(slotEntity, storageComponent, slot.m_iSlotIndex);
+			return EPF_EApplyResult.OK;
 		}
 
-		// Delte any items not found in the storage data for non bakes that always save all slots
-		if (isNotBaked)
+		if (!isNotBaked)
 		{
-			for (int nSlot = 0, count = storageComponent.GetSlotsCount(); nSlot < count; nSlot++)
+			EPF_BakedStorageChange change();
+			if (slotEntity)
 			{
-				if (!processedSlots.Contains(nSlot))
+				EPF_PersistenceComponent slotPersistence = EPF_Component<EPF_PersistenceComponent>.Find(slotEntity);
+				if (!slotPersistence)
 				{
-					IEntity slotEntity = storageComponent.Get(nSlot);
-					if (slotEntity && slotEntity.FindComponent(EPF_PersistenceComponent))
-						storageManager.TryDeleteItem(slotEntity);
+					// Non persistence slot removals can only be overridden by dynamic entity placed into them
+					change.m_sRemovedItemId = "PERMANENT_BAKED_REMOVAL";
+				}
+				else
+				{
+					// Remember slot removals
+					change.m_sRemovedItemId = slotPersistence.GetPersistentId();
 				}
+
+			}
+			else
+			{
+				// Remember slot replacement on baked entities
+				change.m_bReplaced = true;
 			}
+
+			EPF_BakedStorageChange.Set(storageComponent, slotIndex, change);
 		}
 
+		// Slot did not match save-data, delete current entity on it
+		storageManager.TryDeleteItem(slotEntity);
+
+		if (!saveData)
+			return EPF_EApplyResult.OK;
+
+		// Spawn new entity and attach it
+		slotEntity = saveData.Spawn(false);
+		if (!slotEntity)
+			return EPF_EApplyResult.ERROR;
+
+		// Teleport to target position so it is within valid range and if insert fails becomes visible overflow
+		EPF_WorldUtils.Teleport(slotEntity, owner.GetOrigin(), owner.GetYawPitchRoll()[0]);
+
+		// Unable to add it to the storage parent, so put it on the ground at the parent origin
+		storageManager.TryInsertItemInStorage(slotEntity, storageComponent, slotIndex);
+
 		return EPF_EApplyResult.OK;
 	}
 
@@ -235,6 +388,94 @@ class EPF_BaseInventoryStorageComponentSaveData : EPF_ComponentSaveData
 				return false;
 		}
 
+		int groupCount;
+		if (m_aSlotGroups)
+			groupCount = m_aSlotGroups.Count();
+
+		int otherGroupCount;
+		if (otherData.m_aSlotGroups)
+			otherGroupCount = otherData.m_aSlotGroups.Count();
+
+		if (groupCount != otherGroupCount)
+			return false;
+
+		for (int idx = 0; idx < groupCount; idx++)
+		{
+			EPF_PersistentInventoryStorageSlotGroup slotGroup = m_aSlotGroups.Get(idx);
+			if (slotGroup.Equals(otherData.m_aSlotGroups.Get(idx)))
+				continue;
+
+			bool found;
+			foreach (EPF_PersistentInventoryStorageSlotGroup otherGroup : otherData.m_aSlotGroups)
+			{
+				if (slotGroup.Equals(otherGroup))
+				{
+					found = true;
+					break;
+				}
+			}
+
+			if (!found)
+				return false;
+		}
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override void CollectNestedSaveData(notnull array<EPF_EntitySaveData> outNested)
+	{
+		if (m_aSlots)
+		{
+			foreach (EPF_PersistentInventoryStorageSlot persistentSlot : m_aSlots)
+			{
+				if (persistentSlot.m_pEntity)
+					outNested.Insert(persistentSlot.m_pEntity);
+			}
+		}
+
+		if (m_aSlotGroups)
+		{
+			// Once per item, as each of them is spawned
+			foreach (EPF_PersistentInventoryStorageSlotGroup slotGroup : m_aSlotGroups)
+			{
+				for (int nMember = 0, count = slotGroup.m_aSlotIndices.Count(); nMember < count; nMember++)
+				{
+					outNested.Insert(slotGroup.m_pEntity);
+				}
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override bool Recycle()
+	{
+		if (m_aSlots)
+		{
+			foreach (EPF_PersistentInventoryStorageSlot persistentSlot : m_aSlots)
+			{
+				EPF_SaveDataPool.Release(persistentSlot.m_pEntity);
+				persistentSlot.m_pEntity = null;
+				EPF_SaveDataPool.Return(persistentSlot);
+			}
+
+			m_aSlots.Clear();
+		}
+
+		if (m_aSlotGroups)
+		{
+			foreach (EPF_PersistentInventoryStorageSlotGroup slotGroup : m_aSlotGroups)
+			{
+				EPF_SaveDataPool.Release(slotGroup.m_pEntity);
+				slotGroup.m_pEntity = null;
+				slotGroup.m_aSlotIndices.Clear();
+				slotGroup.m_aIds.Clear();
+				EPF_SaveDataPool.Return(slotGroup);
+			}
+
+			m_aSlotGroups.Clear();
+		}
+
 		return true;
 	}
 };
@@ -296,3 +537,87 @@ class EPF_PersistentInventoryStorageSlot
 		return true;
 	}
 };
+
+//! Identical items stored in multiple slots of the same storage
+class EPF_PersistentInventoryStorageSlotGroup
+{
+	ref array<int> m_aSlotIndices;
+	ref array<string> m_aIds;
+	ref EPF_EntitySaveData m_pEntity;
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the save-data of one item of the group. All members share the same instance, so it has to be
+	//! applied before the save-data of the next member is requested.
+	//! \param memberIdx index into m_aSlotIndices and m_aIds
+	//! eturn the group save-data prepared for the member
+	EPF_EntitySaveData GetEntity(int memberIdx)
+	{
+		// Kept as last save-data by the change tracker of every member, so it must never be recycled
+		if (memberIdx == 0 && m_aIds.Count() > 1)
+			EPF_SaveDataPool.Share(m_pEntity);
+
+		m_pEntity.SetId(m_aIds.Get(memberIdx));
+
+		// Applying a member flags the transformation as applied, which would skip it for the next one
+		if (m_pEntity.m_pTransformation)
+			m_pEntity.m_pTransformation.m_bApplied = false;
+
+		return m_pEntity;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	bool Equals(notnull EPF_PersistentInventoryStorageSlotGroup other)
+	{
+		int count = m_aSlotIndices.Count();
+		if (count != other.m_aSlotIndices.Count())
+			return false;
+
+		for (int idx = 0; idx < count; idx++)
+		{
+			if (m_aSlotIndices.Get(idx) != other.m_aSlotIndices.Get(idx) || m_aIds.Get(idx) != other.m_aIds.Get(idx))
+				return false;
+		}
+
+		return m_pEntity.Equals(other.m_pEntity);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected bool SerializationSave(BaseSerializationSaveContext saveContext)
+	{
+		if (!saveContext.IsValid()) return false;
+
+		saveContext.WriteValue("m_aSlotIndices", m_aSlotIndices);
+		saveContext.WriteValue("m_aIds", m_aIds);
+		saveContext.WriteValue("_type", EDF_DbName.Get(m_pEntity.Type()));
+		saveContext.WriteValue("m_pEntity", m_pEntity);
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected bool SerializationLoad(BaseSerializationLoadContext loadContext)
+	{
+		if (!loadContext.IsValid()) return false;
+
+		if (!m_aSlotIndices)
+		{
+			m_aSlotIndices = {};
+			m_aIds = {};
+		}
+
+		loadContext.ReadValue("m_aSlotIndices", m_aSlotIndices);
+		loadContext.ReadValue("m_aIds", m_aIds);
+
+		string entityTypeString;
+		loadContext.ReadValue("_type", entityTypeString);
+
+		typename entityType = EDF_DbName.GetTypeByName(entityTypeString);
+		if (!entityType)
+			return false;
+
+		m_pEntity = EPF_EntitySaveData.Cast(entityType.Spawn());
+		loadContext.ReadValue("m_pEntity", m_pEntity);
+
+		return true;
+	}
+};
@@ -3,43 +3,71 @@ class EPF_BaseMagazineComponentSaveDataClass : EPF_ComponentSaveDataClass
 {
 };
 
-[EDF_DbName.Automatic()]
-class EPF_BaseMagazineComponentSaveData : EPF_ComponentSaveData
+class EPF_BaseMagazineComponentSerializer : EPF_TypedComponentSaveDataSerializer<EPF_BaseMagazineComponentSaveData, BaseMagazineComponent>
 {
-	int m_iAmmoCount;
-
 	//------------------------------------------------------------------------------------------------
-	override EPF_EReadResult ReadFrom(IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes)
+	override protected EPF_EReadResult ReadTyped(EPF_BaseMagazineComponentSaveData saveData, IEntity owner, BaseMagazineComponent component, EPF_ComponentSaveDataClass attributes)
 	{
-		BaseMagazineComponent magazine = BaseMagazineComponent.Cast(component);
-		m_iAmmoCount = magazine.GetAmmoCount();
+		saveData.m_iAmmoCount = component.GetAmmoCount();
 
-		int maxAmmo = magazine.GetMaxAmmoCount();
-		if (magazine.IsUsed())
+		int maxAmmo = component.GetMaxAmmoCount();
+		if (component.IsUsed())
 		{
 			BaseMuzzleComponent parentMuzzle = EPF_Component<BaseMuzzleComponent>.Find(owner.GetParent());
 			if (parentMuzzle)
 				maxAmmo -= parentMuzzle.GetBarrelsCount();
 		}
 
-		if (m_iAmmoCount >= maxAmmo)
+		if (saveData.m_iAmmoCount >= maxAmmo)
 			return EPF_EReadResult.DEFAULT;
 
 		return EPF_EReadResult.OK;
 	}
 
 	//------------------------------------------------------------------------------------------------
-	override EPF_EApplyResult ApplyTo(IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes)
+	override protected EPF_EApplyResult ApplyTyped(EPF_BaseMagazineComponentSaveData saveData, IEntity owner, BaseMagazineComponent component, EPF_ComponentSaveDataClass attributes)
 	{
-		BaseMagazineComponent magazine = BaseMagazineComponent.Cast(component);
-		magazine.SetAmmoCount(m_iAmmoCount);
+		component.SetAmmoCount(saveData.m_iAmmoCount);
 		return EPF_EApplyResult.OK;
 	}
 
 	//------------------------------------------------------------------------------------------------
-	override bool Equals(notnull EPF_ComponentSaveData other)
+	override protected bool EqualsTyped(EPF_BaseMagazineComponentSaveData saveData, EPF_BaseMagazineComponentSaveData other)
+	{
+		return saveData.m_iAmmoCount == other.m_iAmmoCount;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override bool CanEncode()
+	{
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override protected bool EncodeTyped(EPF_BaseMagazineComponentSaveData saveData, BaseSerializationSaveContext saveContext)
+	{
+		saveContext.WriteValue("m_iDataLayoutVersion", saveData.m_iDataLayoutVersion);
+		saveContext.WriteValue("m_iAmmoCount", saveData.m_iAmmoCount);
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override protected bool DecodeTyped(EPF_BaseMagazineComponentSaveData saveData, BaseSerializationLoadContext loadContext)
+	{
+		loadContext.ReadValue("m_iDataLayoutVersion", saveData.m_iDataLayoutVersion);
+		loadContext.ReadValue("m_iAmmoCount", saveData.m_iAmmoCount);
+		return true;
+	}
+};
+
+[EPF_ComponentSaveDataSerializerType(EPF_BaseMagazineComponentSerializer), EDF_DbName.Automatic()]
+class EPF_BaseMagazineComponentSaveData : EPF_ComponentSaveData
+{
+	int m_iAmmoCount;
+
+	//------------------------------------------------------------------------------------------------
+	override bool Recycle()
 	{
-		EPF_BaseMagazineComponentSaveData otherData = EPF_BaseMagazineComponentSaveData.Cast(other);
-		return m_iAmmoCount == otherData.m_iAmmoCount;
+		return true;
 	}
 };
@@ -35,7 +35,7 @@ class EPF_BaseSlotComponentSaveData : EPF_ComponentSaveData
 
 		// Read transform to see if slot uses OverrideTransformLS set.
 		// Reuse logic from slot manager that should be used instead of base slot anyway ...
-		EPF_SlotManagerComponentSaveData.ReadTransform(slotEntity, saveData, prefabInfo, readResult);
+		EPF_SlotManagerComponentSaveData.ReadTransform(slotEntity, saveData, prefabInfo, readResult, slotPersistence.GetSettings());
 
 		// We can safely ignore baked objects with default info on them, but anything else needs to be saved.
 		if (attributes.m_bTrimDefaults &&
@@ -43,6 +43,7 @@ class EPF_BaseSlotComponentSaveData : EPF_ComponentSaveData
 			EPF_BitFlags.CheckFlags(slotPersistence.GetFlags(), EPF_EPersistenceFlags.BAKED) &&
 			readResult == EPF_EReadResult.DEFAULT)
 		{
+			EPF_SaveDataPool.Release(saveData);
 			return EPF_EReadResult.DEFAULT;
 		}
 
@@ -64,6 +65,21 @@ class EPF_BaseSlotComponentSaveData : EPF_ComponentSaveData
 		return (!m_pEntity && !otherData.m_pEntity) || m_pEntity.Equals(otherData.m_pEntity);
 	}
 
+	//------------------------------------------------------------------------------------------------
+	override void CollectNestedSaveData(notnull array<EPF_EntitySaveData> outNested)
+	{
+		if (m_pEntity)
+			outNested.Insert(m_pEntity);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override bool Recycle()
+	{
+		EPF_SaveDataPool.Release(m_pEntity);
+		m_pEntity = null;
+		return true;
+	}
+
 	//------------------------------------------------------------------------------------------------
 	protected bool SerializationSave(BaseSerializationSaveContext saveContext)
 	{
@@ -8,9 +8,19 @@ class EPF_CompartmentAccessComponentSaveDataClass : EPF_ComponentSaveDataClass
 [EDF_DbName.Automatic()]
 class EPF_CompartmentAccessComponentSaveData : EPF_ComponentSaveData
 {
+	protected static int s_iGetInVehicleHandle = EPF_DeferredApplyResult.RegisterIdentifier("CompartmentAccessComponentSaveData::GetInVehicle");
+
+	protected static const int GET_IN_TIMEOUT = 500;
+
 	string m_sEntity;
 	int m_iSlotIdx;
 
+	[NonSerialized()]
+	protected IEntity m_pOccupant;
+
+	[NonSerialized()]
+	protected EventHandlerManagerComponent m_pGetInEventHandler;
+
 	//------------------------------------------------------------------------------------------------
 	override EPF_EReadResult ReadFrom(IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes)
 	{
@@ -75,9 +85,18 @@ class EPF_CompartmentAccessComponentSaveData : EPF_ComponentSaveData
 			compartmentManager.GetCompartments(outCompartments);
 			if (m_iSlotIdx < outCompartments.Count())
 			{
-				EPF_DeferredApplyResult.AddPending(this, "CompartmentAccessComponentSaveData::GetInVehicle");
-				compartment.GetInVehicle(compartmentHolder, outCompartments.Get(m_iSlotIdx), true, -1, ECloseDoorAfterActions.INVALID, true);
-				GetGame().GetCallqueue().CallLater(Complete, 500);
+				BaseCompartmentSlot compartmentSlot = outCompartments.Get(m_iSlotIdx);
+				EPF_DeferredApplyResult.AddPending(this, s_iGetInVehicleHandle);
+
+				// Complete as soon as the character is seated, the fixed time is only a fallback
+				m_pOccupant = owner;
+				m_pGetInEventHandler = EPF_Component<EventHandlerManagerComponent>.Find(compartmentSlot.GetOwner());
+				if (m_pGetInEventHandler)
+					m_pGetInEventHandler.RegisterScriptHandler("OnCompartmentEntered", this, OnCompartmentEntered);
+
+				GetGame().GetCallqueue().CallLater(FinishGetIn, GET_IN_TIMEOUT);
+
+				compartment.GetInVehicle(compartmentHolder, compartmentSlot, true, -1, ECloseDoorAfterActions.INVALID, true);
 				return EPF_EApplyResult.AWAIT_COMPLETION;
 			}
 		}
@@ -89,9 +108,26 @@ class EPF_CompartmentAccessComponentSaveData : EPF_ComponentSaveData
 		return EPF_EApplyResult.OK;
 	}
 
-	protected void Complete()
+	//------------------------------------------------------------------------------------------------
+	protected event void OnCompartmentEntered(IEntity vehicle, BaseCompartmentManagerComponent mgr, IEntity occupant, int managerId, int slotID)
 	{
-		EPF_DeferredApplyResult.SetFinished(this, "CompartmentAccessComponentSaveData::GetInVehicle");
+		if (occupant == m_pOccupant)
+			FinishGetIn();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void FinishGetIn()
+	{
+		if (!m_pOccupant)
+			return; // Already finished by the event or the time limit
+
+		GetGame().GetCallqueue().Remove(FinishGetIn);
+		if (m_pGetInEventHandler)
+			m_pGetInEventHandler.RemoveScriptHandler("OnCompartmentEntered", this, OnCompartmentEntered);
+
+		m_pGetInEventHandler = null;
+		m_pOccupant = null;
+		EPF_DeferredApplyResult.SetFinished(this, s_iGetInVehicleHandle);
 	}
 
 	//------------------------------------------------------------------------------------------------
@@ -11,7 +11,14 @@ class EPF_FuelManagerComponentSaveData : EPF_ComponentSaveData
 	//------------------------------------------------------------------------------------------------
 	override EPF_EReadResult ReadFrom(IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes)
 	{
-		m_aFuelNodes = {};
+		if (m_aFuelNodes)
+		{
+			m_aFuelNodes.Clear();
+		}
+		else
+		{
+			m_aFuelNodes = {};
+		}
 
 		array<BaseFuelNode> outNodes();
 		FuelManagerComponent.Cast(component).GetFuelNodesList(outNodes);
@@ -127,6 +134,12 @@ class EPF_FuelManagerComponentSaveData : EPF_ComponentSaveData
 
 		return true;
 	}
+
+	//------------------------------------------------------------------------------------------------
+	override bool Recycle()
+	{
+		return true;
+	}
 }
 
 class EPF_PersistentFuelNode
@@ -5,21 +5,24 @@ class EPF_HitZoneContainerComponentSaveDataClass : EPF_ComponentSaveDataClass
 	ref array<string> m_aHitzoneFilter;
 };
 
-[EDF_DbName.Automatic()]
-class EPF_HitZoneContainerComponentSaveData : EPF_ComponentSaveData
+class EPF_HitZoneContainerComponentSerializer : EPF_TypedComponentSaveDataSerializer<EPF_HitZoneContainerComponentSaveData, HitZoneContainerComponent>
 {
-	ref array<ref EPF_PersistentHitZone> m_aHitzones;
-
 	//------------------------------------------------------------------------------------------------
-	override EPF_EReadResult ReadFrom(IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes)
+	override protected EPF_EReadResult ReadTyped(EPF_HitZoneContainerComponentSaveData saveData, IEntity owner, HitZoneContainerComponent component, EPF_ComponentSaveDataClass attributes)
 	{
 		EPF_HitZoneContainerComponentSaveDataClass settings = EPF_HitZoneContainerComponentSaveDataClass.Cast(attributes);
-		HitZoneContainerComponent hitZoneContainer = HitZoneContainerComponent.Cast(component);
 
-		m_aHitzones = {};
+		if (saveData.m_aHitzones)
+		{
+			saveData.m_aHitzones.Clear();
+		}
+		else
+		{
+			saveData.m_aHitzones = {};
+		}
 
 		array<HitZone> outHitZones();
-		hitZoneContainer.GetAllHitZones(outHitZones);
+		component.GetAllHitZones(outHitZones);
 
 		foreach (HitZone hitZone : outHitZones)
 		{
@@ -30,25 +33,24 @@ class EPF_HitZoneContainerComponentSaveData : EPF_ComponentSaveData
 			if (settings.m_bTrimDefaults && float.AlmostEqual(persistentHitZone.m_fHealth, 1.0)) continue;
 			if (!settings.m_aHitzoneFilter.IsEmpty() && !settings.m_aHitzoneFilter.Contains(persistentHitZone.m_sName)) continue;
 
-			m_aHitzones.Insert(persistentHitZone);
+			saveData.m_aHitzones.Insert(persistentHitZone);
 		}
 
-		if (m_aHitzones.IsEmpty()) return EPF_EReadResult.DEFAULT;
+		if (saveData.m_aHitzones.IsEmpty()) return EPF_EReadResult.DEFAULT;
 		return EPF_EReadResult.OK;
 	}
 
 	//------------------------------------------------------------------------------------------------
-	override EPF_EApplyResult ApplyTo(IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes)
+	override protected EPF_EApplyResult ApplyTyped(EPF_HitZoneContainerComponentSaveData saveData, IEntity owner, HitZoneContainerComponent component, EPF_ComponentSaveDataClass attributes)
 	{
 		EPF_EApplyResult result = EPF_EApplyResult.OK;
 
 		array<HitZone> outHitZones();
-		HitZoneContainerComponent hitZoneContainer = HitZoneContainerComponent.Cast(component);
-		hitZoneContainer.GetAllHitZones(outHitZones);
+		component.GetAllHitZones(outHitZones);
 
-		bool tryIdxAcces = outHitZones.Count() >= m_aHitzones.Count();
+		bool tryIdxAcces = outHitZones.Count() >= saveData.m_aHitzones.Count();
 
-		foreach (int idx, EPF_PersistentHitZone persistentHitZone : m_aHitzones)
+		foreach (int idx, EPF_PersistentHitZone persistentHitZone : saveData.m_aHitzones)
 		{
 			HitZone hitZone;
 
@@ -86,21 +88,19 @@ class EPF_HitZoneContainerComponentSaveData : EPF_ComponentSaveData
 	}
 
 	//------------------------------------------------------------------------------------------------
-	override bool Equals(notnull EPF_ComponentSaveData other)
+	override protected bool EqualsTyped(EPF_HitZoneContainerComponentSaveData saveData, EPF_HitZoneContainerComponentSaveData other)
 	{
-		EPF_HitZoneContainerComponentSaveData otherData = EPF_HitZoneContainerComponentSaveData.Cast(other);
-
-		if (m_aHitzones.Count() != otherData.m_aHitzones.Count())
+		if (saveData.m_aHitzones.Count() != other.m_aHitzones.Count())
 			return false;
 
-		foreach (int idx, EPF_PersistentHitZone hitZone : m_aHitzones)
+		foreach (int idx, EPF_PersistentHitZone hitZone : saveData.m_aHitzones)
 		{
 			// Try same index first as they are likely to be the correct ones.
-			if (hitZone.Equals(otherData.m_aHitzones.Get(idx)))
+			if (hitZone.Equals(other.m_aHitzones.Get(idx)))
 				continue;
 
 			bool found;
-			foreach (int compareIdx, EPF_PersistentHitZone otherhitZone : otherData.m_aHitzones)
+			foreach (int compareIdx, EPF_PersistentHitZone otherhitZone : other.m_aHitzones)
 			{
 				if (compareIdx == idx)
 					continue; // Already tried in idx direct compare
@@ -120,6 +120,18 @@ class EPF_HitZoneContainerComponentSaveData : EPF_ComponentSaveData
 	}
 };
 
+[EPF_ComponentSaveDataSerializerType(EPF_HitZoneContainerComponentSerializer), EDF_DbName.Automatic()]
+class EPF_HitZoneContainerComponentSaveData : EPF_ComponentSaveData
+{
+	ref array<ref EPF_PersistentHitZone> m_aHitzones;
+
+	//------------------------------------------------------------------------------------------------
+	override bool Recycle()
+	{
+		return true;
+	}
+};
+
 class EPF_PersistentHitZone
 {
 	string m_sName;
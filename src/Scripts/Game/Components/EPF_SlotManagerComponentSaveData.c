@@ -16,7 +16,15 @@ class EPF_SlotManagerComponentSaveData : EPF_ComponentSaveData
 		SlotManagerComponent slotManager = SlotManagerComponent.Cast(component);
 		EPF_SlotManagerComponentSaveDataClass settings = EPF_SlotManagerComponentSaveDataClass.Cast(attributes);
 
-		m_aSlots = {};
+		if (m_aSlots)
+		{
+			m_aSlots.Clear();
+		}
+		else
+		{
+			m_aSlots = {};
+		}
+
 		array<ref EPF_EntitySlotPrefabInfo> slotinfos = EPF_EntitySlotPrefabInfo.GetSlotInfos(owner, slotManager);
 
 		array<EntitySlotInfo> outSlotInfos();
@@ -35,7 +43,7 @@ class EPF_SlotManagerComponentSaveData : EPF_ComponentSaveData
 				// Slot is different from prefab and the new slot has no persistence component so we clear it.
 				if (!isPrefabMatch)
 				{
-					EPF_PersistentEntitySlot persistentSlot();
+					EPF_PersistentEntitySlot persistentSlot = EPF_PersistentEntitySlot.Cast(EPF_SaveDataPool.Get(EPF_PersistentEntitySlot));
 					persistentSlot.m_sName = prefabInfo.m_sName;
 					m_aSlots.Insert(persistentSlot);
 				}
@@ -49,7 +57,7 @@ class EPF_SlotManagerComponentSaveData : EPF_ComponentSaveData
 				return EPF_EReadResult.ERROR;
 
 			// Read transform to see if slot uses OverrideTransformLS set.
-			ReadTransform(slotEntity, saveData, prefabInfo, readResult);
+			ReadTransform(slotEntity, saveData, prefabInfo, readResult, slotPersistence.GetSettings());
 
 			// We can safely ignore baked objects with default info on them, but anything else needs to be saved.
 			if (attributes.m_bTrimDefaults &&
@@ -58,10 +66,11 @@ class EPF_SlotManagerComponentSaveData : EPF_ComponentSaveData
 				(settings.m_bSkipDefaultNonBaked ||
 				EPF_BitFlags.CheckFlags(slotPersistence.GetFlags(), EPF_EPersistenceFlags.BAKED)))
 			{
+				EPF_SaveDataPool.Release(saveData);
 				continue;
 			}
 
-			EPF_PersistentEntitySlot persistentSlot();
+			EPF_PersistentEntitySlot persistentSlot = EPF_PersistentEntitySlot.Cast(EPF_SaveDataPool.Get(EPF_PersistentEntitySlot));
 			persistentSlot.m_sName = prefabInfo.m_sName;
 			persistentSlot.m_pEntity = saveData;
 			m_aSlots.Insert(persistentSlot);
@@ -74,9 +83,11 @@ class EPF_SlotManagerComponentSaveData : EPF_ComponentSaveData
 	}
 
 	//------------------------------------------------------------------------------------------------
-	static void ReadTransform(IEntity slotEntity, EPF_EntitySaveData saveData, EPF_EntitySlotPrefabInfo prefabInfo, out EPF_EReadResult readResult)
+	static void ReadTransform(IEntity slotEntity, EPF_EntitySaveData saveData, EPF_EntitySlotPrefabInfo prefabInfo, out EPF_EReadResult readResult, EPF_PersistenceComponentClass slotAttributes = null)
 	{
-		EPF_PersistenceComponentClass slotAttributes = EPF_ComponentData<EPF_PersistenceComponentClass>.Get(slotEntity);
+		if (!slotAttributes)
+			slotAttributes = EPF_ComponentData<EPF_PersistenceComponentClass>.Get(slotEntity);
+
 		if (saveData.m_pTransformation.ReadFrom(slotEntity, slotAttributes.m_pSaveData, false))
 		{
 			if (!EPF_Const.IsUnset(saveData.m_pTransformation.m_vOrigin) &&
@@ -223,6 +234,37 @@ class EPF_SlotManagerComponentSaveData : EPF_ComponentSaveData
 
 		return true;
 	}
+
+	//------------------------------------------------------------------------------------------------
+	override void CollectNestedSaveData(notnull array<EPF_EntitySaveData> outNested)
+	{
+		if (!m_aSlots)
+			return;
+
+		foreach (EPF_PersistentEntitySlot persistentSlot : m_aSlots)
+		{
+			if (persistentSlot.m_pEntity)
+				outNested.Insert(persistentSlot.m_pEntity);
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override bool Recycle()
+	{
+		if (m_aSlots)
+		{
+			foreach (EPF_PersistentEntitySlot persistentSlot : m_aSlots)
+			{
+				EPF_SaveDataPool.Release(persistentSlot.m_pEntity);
+				persistentSlot.m_pEntity = null;
+				EPF_SaveDataPool.Return(persistentSlot);
+			}
+
+			m_aSlots.Clear();
+		}
+
+		return true;
+	}
 }
 
 class EPF_PersistentEntitySlot
@@ -6,6 +6,8 @@ class EPF_TurretControllerComponentSaveDataClass : EPF_ComponentSaveDataClass
 [EDF_DbName.Automatic()]
 class EPF_TurretControllerComponentSaveData : EPF_ComponentSaveData
 {
+	protected static int s_iSetAimingAnglesHandle = EPF_DeferredApplyResult.RegisterIdentifier("TurretControllerComponentSaveData::SetAimingAngles");
+
 	float m_fYaw;
 	float m_fPitch;
 	int m_iSelectedWeaponSlotIdx;
@@ -72,7 +74,7 @@ class EPF_TurretControllerComponentSaveData : EPF_ComponentSaveData
 		}
 
 		// Need to push this 2 frames later because max angles are set on frame after turret spawned ...
-		EPF_DeferredApplyResult.AddPending(this, "TurretControllerComponentSaveData::SetAimingAngles");
+		EPF_DeferredApplyResult.AddPending(this, s_iSetAimingAnglesHandle);
 		GetGame().GetCallqueue().Call(SetAimingAngles, turretController, m_fYaw * Math.DEG2RAD, m_fPitch * Math.DEG2RAD, true);
 
 		return EPF_EApplyResult.AWAIT_COMPLETION;
@@ -93,7 +95,7 @@ class EPF_TurretControllerComponentSaveData : EPF_ComponentSaveData
 			turretController.SetAimingAngles(yaw, pitch);
 		}
 
-		EPF_DeferredApplyResult.SetFinished(this, "TurretControllerComponentSaveData::SetAimingAngles");
+		EPF_DeferredApplyResult.SetFinished(this, s_iSetAimingAnglesHandle);
 	}
 
 	//------------------------------------------------------------------------------------------------
@@ -41,6 +41,7 @@ class EPF_WeaponSlotComponentSaveData : EPF_ComponentSaveData
 			EPF_BitFlags.CheckFlags(slotPersistence.GetFlags(), EPF_EPersistenceFlags.BAKED) &&
 			readResult == EPF_EReadResult.DEFAULT)
 		{
+			EPF_SaveDataPool.Release(saveData);
 			return EPF_EReadResult.DEFAULT;
 		}
 
@@ -99,6 +100,21 @@ class EPF_WeaponSlotComponentSaveData : EPF_ComponentSaveData
 		return (m_iSlotIndex == otherData.m_iSlotIndex) && ((!m_pEntity && !otherData.m_pEntity) || m_pEntity.Equals(otherData.m_pEntity));
 	}
 
+	//------------------------------------------------------------------------------------------------
+	override void CollectNestedSaveData(notnull array<EPF_EntitySaveData> outNested)
+	{
+		if (m_pEntity)
+			outNested.Insert(m_pEntity);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override bool Recycle()
+	{
+		EPF_SaveDataPool.Release(m_pEntity);
+		m_pEntity = null;
+		return true;
+	}
+
 	//------------------------------------------------------------------------------------------------
 	protected bool SerializationSave(BaseSerializationSaveContext saveContext)
 	{
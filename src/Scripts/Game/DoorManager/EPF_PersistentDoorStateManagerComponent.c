@@ -7,9 +7,16 @@ class EPF_PersistentDoorStateManagerComponentClass : EPF_PersistenceManagerExten
 
 class EPF_PersistentDoorStateManagerComponent : EPF_PersistenceManagerExtensionBaseComponent
 {
+	// Doors have no event for control value changes, so their state is checked at this interval
+	protected static const int DOOR_STATE_CHECK_INTERVAL = 100;
+
+	// Fallback for doors that never report the restored state
+	protected static const int DOOR_STATE_TIMEOUT = 1000;
+
 	protected static EPF_PersistentDoorStateManagerComponent m_pInstance;
 	protected ref EPF_PersistentDoorStateManager m_pDoorStateManager;
-	protected bool m_bLoaded;
+	protected ref array<DoorComponent> m_aAwaitedDoors;
+	protected ref array<float> m_aAwaitedControlValues;
 
 	//------------------------------------------------------------------------------------------------
 	override void OnSetup(EPF_PersistenceManager persistenceManager)
@@ -20,9 +27,10 @@ class EPF_PersistentDoorStateManagerComponent : EPF_PersistenceManagerExtensionB
 	}
 
 	//------------------------------------------------------------------------------------------------
-	override bool IsSetupComplete(EPF_PersistenceManager persistenceManager)
+	//! Doors are part of the map, so their states can be restored while the persistent entities are still loading
+	override bool IsWorldLoadRequired()
 	{
-		return m_bLoaded;
+		return false;
 	}
 
 	//------------------------------------------------------------------------------------------------
@@ -40,7 +48,7 @@ class EPF_PersistentDoorStateManagerComponent : EPF_PersistenceManagerExtensionB
 		{
 			m_pDoorStateManager = new EPF_PersistentDoorStateManager();
 			m_pDoorStateManager.SetPersistentId(GetDoorStateManagerPersistentId());
-			m_bLoaded = true;
+			SetSetupComplete();
 		}
 
 		auto settings = EPF_PersistentDoorStateManagerComponentClass.Cast(GetComponentData(GetOwner()));
@@ -53,10 +61,58 @@ class EPF_PersistentDoorStateManagerComponent : EPF_PersistenceManagerExtensionB
 		return m_pInstance;
 	}
 
+	//------------------------------------------------------------------------------------------------
+	//! Wait for the door to reach the restored control value before the setup is complete
+	void AwaitDoorState(notnull DoorComponent door, float controlValue)
+	{
+		if (!m_aAwaitedDoors)
+		{
+			m_aAwaitedDoors = {};
+			m_aAwaitedControlValues = {};
+		}
+
+		m_aAwaitedDoors.Insert(door);
+		m_aAwaitedControlValues.Insert(controlValue);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Complete the loading once all awaited doors reached their state
+	void StartAwaitDoorStates()
+	{
+		GetGame().GetCallqueue().CallLater(CheckDoorStates, DOOR_STATE_CHECK_INTERVAL, true);
+		GetGame().GetCallqueue().CallLater(SetLoadingComplete, DOOR_STATE_TIMEOUT);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void CheckDoorStates()
+	{
+		if (m_aAwaitedDoors)
+		{
+			for (int idx = m_aAwaitedDoors.Count() - 1; idx >= 0; idx--)
+			{
+				DoorComponent door = m_aAwaitedDoors.Get(idx);
+				if (door && !float.AlmostEqual(door.GetControlValue(), m_aAwaitedControlValues.Get(idx)))
+					continue;
+
+				m_aAwaitedDoors.Remove(idx);
+				m_aAwaitedControlValues.Remove(idx);
+			}
+
+			if (!m_aAwaitedDoors.IsEmpty())
+				return;
+		}
+
+		SetLoadingComplete();
+	}
+
 	//------------------------------------------------------------------------------------------------
 	void SetLoadingComplete()
 	{
-		m_bLoaded = true;
+		GetGame().GetCallqueue().Remove(CheckDoorStates);
+		GetGame().GetCallqueue().Remove(SetLoadingComplete);
+		m_aAwaitedDoors = null;
+		m_aAwaitedControlValues = null;
+		SetSetupComplete();
 	}
 
 	//------------------------------------------------------------------------------------------------
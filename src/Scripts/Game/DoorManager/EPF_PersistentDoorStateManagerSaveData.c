@@ -22,7 +22,7 @@ class EPF_PersistentDoorStateManagerSaveData : EPF_ScriptedStateSaveData
 			if (state.ReadFrom(dataTuple.param1, dataTuple.param2) == EPF_EReadResult.DEFAULT)
 				continue;
 
-			string mapKey = EPF_Utils.GetPrefabGUID(EPF_Utils.GetPrefabName(dataTuple.param1)) + "@" + dataTuple.param1.GetOrigin().ToString(false);
+			string mapKey = EPF_PrefabCatalog.GetPrefabGUID(EPF_Utils.GetPrefabName(dataTuple.param1)) + "@" + dataTuple.param1.GetOrigin().ToString(false);
 			m_mStates.Set(mapKey, state);
 		}
 
@@ -36,6 +36,7 @@ class EPF_PersistentDoorStateManagerSaveData : EPF_ScriptedStateSaveData
 	override EPF_EApplyResult ApplyTo(notnull Managed scriptedState)
 	{
 		auto doorStateManager = EPF_PersistentDoorStateManager.Cast(scriptedState);
+		EPF_PersistentDoorStateManagerComponent managerComponent = EPF_PersistentDoorStateManagerComponent.GetInstance();
 
 		foreach (string mapKey, EPF_PersistentDoorStateStruct state : m_mStates)
 		{
@@ -56,12 +57,12 @@ class EPF_PersistentDoorStateManagerSaveData : EPF_ScriptedStateSaveData
 			if (state.ApplyTo(doorEntity, door))
 			{
 				doorStateManager.m_aTrackedDoors.Insert(new Tuple2<IEntity, DoorComponent>(doorEntity, door));
+				managerComponent.AwaitDoorState(door, state.m_fControlValue);
 				Print(string.Format("Restored door %1@%2", prefab, origin), LogLevel.VERBOSE);
 			}
 		}
 
-		// TODO: Replace hardcoded delay when we can use the max of all doors opening times: https://feedback.bistudio.com/T174535
-		GetGame().GetCallqueue().CallLater(EPF_PersistentDoorStateManagerComponent.GetInstance().SetLoadingComplete, 1000);
+		managerComponent.StartAwaitDoorStates();
 		return EPF_EApplyResult.AWAIT_COMPLETION;
 	}
 
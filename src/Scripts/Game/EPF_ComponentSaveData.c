@@ -25,6 +25,10 @@ class EPF_ComponentSaveData
 	//! \return EPF_EReadResult.OK if save-data could be read, ERROR if something failed, DEFAULT if the data could be trimmed
 	EPF_EReadResult ReadFrom(IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes)
 	{
+		EPF_ComponentSaveDataSerializer serializer = EPF_ComponentSaveDataSerializerType.Get(Type());
+		if (serializer)
+			return serializer.Read(this, owner, component, attributes);
+
 		return EDF_DbEntityUtils.StructAutoCopy(component, this);
 	}
 
@@ -47,6 +51,10 @@ class EPF_ComponentSaveData
 	//! \return true if save-data could be applied, false if something failed.
 	EPF_EApplyResult ApplyTo(IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes)
 	{
+		EPF_ComponentSaveDataSerializer serializer = EPF_ComponentSaveDataSerializerType.Get(Type());
+		if (serializer)
+			return serializer.Apply(this, owner, component, attributes);
+
 		return EDF_DbEntityUtils.StructAutoCopy(this, component);
 	}
 
@@ -56,8 +64,27 @@ class EPF_ComponentSaveData
 	//! \return true if save-data is considered to describe the same data. False on differences.
 	bool Equals(notnull EPF_ComponentSaveData other)
 	{
+		EPF_ComponentSaveDataSerializer serializer = EPF_ComponentSaveDataSerializerType.Get(Type());
+		if (serializer)
+			return serializer.Equals(this, other);
+
 		return EPF_SavaDataUtils.StructAutoCompare(this, other);
 	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Collect the entity save-data nested inside of this component save-data (e.g. items inside a storage).
+	//! Override if the save-data holds entity save-data, so e.g. the prefabs of nested entities can be preloaded.
+	//! \param outNested nested entity save-data, without their own nested save-data
+	void CollectNestedSaveData(notnull array<EPF_EntitySaveData> outNested);
+
+	//------------------------------------------------------------------------------------------------
+	//! Reset hook for save-data pooling. Override and return true if ReadFrom overwrites all fields, or they are cleared here.
+	//! Nested entity save-data must be handed back using EPF_SaveDataPool.Release.
+	//! \return true if the instance can be reused, false if it has to be left to the garbage collector
+	bool Recycle()
+	{
+		return false;
+	}
 };
 
 class EPF_ComponentSaveDataType : BaseContainerCustomTitle
@@ -0,0 +1,159 @@
+//! Hand-written read, apply, compare and encode logic for a component save-data type, preferred by EPF_ComponentSaveData over the reflection based defaults.
+//! Inherit from EPF_TypedComponentSaveDataSerializer instead of this class to get strong typed save-data and component arguments.
+class EPF_ComponentSaveDataSerializer
+{
+	//------------------------------------------------------------------------------------------------
+	//! See EPF_ComponentSaveData.ReadFrom
+	EPF_EReadResult Read(notnull EPF_ComponentSaveData saveData, IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes);
+
+	//------------------------------------------------------------------------------------------------
+	//! See EPF_ComponentSaveData.ApplyTo
+	EPF_EApplyResult Apply(notnull EPF_ComponentSaveData saveData, IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes);
+
+	//------------------------------------------------------------------------------------------------
+	//! See EPF_ComponentSaveData.Equals
+	bool Equals(notnull EPF_ComponentSaveData saveData, notnull EPF_ComponentSaveData other);
+
+	//------------------------------------------------------------------------------------------------
+	//! Override and return true if Encode and Decode write and read all fields of the save-data.
+	//! Otherwise the save-data is encoded for the database via reflection.
+	bool CanEncode()
+	{
+		return false;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Write the save-data fields. Use the field names reflection would use, so existing records stay readable.
+	bool Encode(notnull EPF_ComponentSaveData saveData, notnull BaseSerializationSaveContext saveContext);
+
+	//------------------------------------------------------------------------------------------------
+	//! Read the save-data fields written by Encode
+	bool Decode(notnull EPF_ComponentSaveData saveData, notnull BaseSerializationLoadContext loadContext);
+}
+
+//! Serializer base with the save-data and component already cast to their types.
+//! Example: class TAG_MyCustomComponentSerializer : EPF_TypedComponentSaveDataSerializer<TAG_MyCustomComponentSaveData, TAG_MyCustomComponent>
+class EPF_TypedComponentSaveDataSerializer<Class TSaveData, Class TComponent> : EPF_ComponentSaveDataSerializer
+{
+	//------------------------------------------------------------------------------------------------
+	protected EPF_EReadResult ReadTyped(TSaveData saveData, IEntity owner, TComponent component, EPF_ComponentSaveDataClass attributes);
+
+	//------------------------------------------------------------------------------------------------
+	protected EPF_EApplyResult ApplyTyped(TSaveData saveData, IEntity owner, TComponent component, EPF_ComponentSaveDataClass attributes);
+
+	//------------------------------------------------------------------------------------------------
+	protected bool EqualsTyped(TSaveData saveData, TSaveData other);
+
+	//------------------------------------------------------------------------------------------------
+	protected bool EncodeTyped(TSaveData saveData, BaseSerializationSaveContext saveContext);
+
+	//------------------------------------------------------------------------------------------------
+	protected bool DecodeTyped(TSaveData saveData, BaseSerializationLoadContext loadContext);
+
+	//------------------------------------------------------------------------------------------------
+	sealed override EPF_EReadResult Read(notnull EPF_ComponentSaveData saveData, IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes)
+	{
+		return ReadTyped(TSaveData.Cast(saveData), owner, TComponent.Cast(component), attributes);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	sealed override EPF_EApplyResult Apply(notnull EPF_ComponentSaveData saveData, IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes)
+	{
+		return ApplyTyped(TSaveData.Cast(saveData), owner, TComponent.Cast(component), attributes);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	sealed override bool Equals(notnull EPF_ComponentSaveData saveData, notnull EPF_ComponentSaveData other)
+	{
+		return EqualsTyped(TSaveData.Cast(saveData), TSaveData.Cast(other));
+	}
+
+	//------------------------------------------------------------------------------------------------
+	sealed override bool Encode(notnull EPF_ComponentSaveData saveData, notnull BaseSerializationSaveContext saveContext)
+	{
+		return EncodeTyped(TSaveData.Cast(saveData), saveContext);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	sealed override bool Decode(notnull EPF_ComponentSaveData saveData, notnull BaseSerializationLoadContext loadContext)
+	{
+		return DecodeTyped(TSaveData.Cast(saveData), loadContext);
+	}
+}
+
+//! Register a serializer for the component save-data class this attribute is added to.
+//! Derived save-data types use it too unless they register their own, except for the encoding as they may add fields.
+class EPF_ComponentSaveDataSerializerType
+{
+	protected static ref map<typename, ref EPF_ComponentSaveDataSerializer> s_mSerializers;
+
+	// Serializer per save-data type including the ones inherited from a parent type, null entries for types without any
+	protected static ref map<typename, EPF_ComponentSaveDataSerializer> s_mResolved;
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the serializer registered for the type or the closest parent type
+	//! \param saveDataType component save-data type
+	//! \return serializer instance or null if the type uses the reflection based defaults
+	static EPF_ComponentSaveDataSerializer Get(typename saveDataType)
+	{
+		if (!s_mSerializers)
+			return null;
+
+		EPF_ComponentSaveDataSerializer serializer;
+		if (s_mResolved.Find(saveDataType, serializer))
+			return serializer;
+
+		typename type = saveDataType;
+		while (type && !serializer)
+		{
+			serializer = s_mSerializers.Get(type);
+			type = type.GetParent();
+		}
+
+		s_mResolved.Set(saveDataType, serializer);
+		return serializer;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the serializer registered for exactly this type if it handles the encoding
+	//! \param saveDataType component save-data type
+	//! \return serializer instance or null if the type is encoded via reflection
+	static EPF_ComponentSaveDataSerializer GetEncoder(typename saveDataType)
+	{
+		if (!s_mSerializers)
+			return null;
+
+		EPF_ComponentSaveDataSerializer serializer = s_mSerializers.Get(saveDataType);
+		if (serializer && serializer.CanEncode())
+			return serializer;
+
+		return null;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void EPF_ComponentSaveDataSerializerType(typename serializerType)
+	{
+		typename saveDataType = EDF_ReflectionUtils.GetAttributeParent();
+
+		if (!saveDataType.IsInherited(EPF_ComponentSaveData))
+		{
+			Debug.Error(string.Format("Failed to register '%1' as serializer for '%2'. '%2' must inherit from '%3'.", serializerType, saveDataType, EPF_ComponentSaveData));
+			return;
+		}
+
+		EPF_ComponentSaveDataSerializer serializer = EPF_ComponentSaveDataSerializer.Cast(serializerType.Spawn());
+		if (!serializer)
+		{
+			Debug.Error(string.Format("Failed to register '%1' as serializer for '%2'. '%1' must inherit from '%3'.", serializerType, saveDataType, EPF_ComponentSaveDataSerializer));
+			return;
+		}
+
+		if (!s_mSerializers)
+			s_mSerializers = new map<typename, ref EPF_ComponentSaveDataSerializer>();
+
+		s_mSerializers.Set(saveDataType, serializer);
+
+		// Derived types might have been resolved to a parent serializer before
+		s_mResolved = new map<typename, EPF_ComponentSaveDataSerializer>();
+	}
+}
@@ -1,5 +1,7 @@
 class EPF_DeferredApplyResult
 {
+	protected static const int TIMEOUT_CHECK_INTERVAL = 1000;
+
 	protected static ref map<ref EPF_EntitySaveData, ref EPF_PendingIdentifierHolder> s_mPendingIdentifiers =
 		new map<ref EPF_EntitySaveData, ref EPF_PendingIdentifierHolder>;
 
@@ -8,6 +10,59 @@ class EPF_DeferredApplyResult
 
 	protected static ref set<ref EPF_EntitySaveData> s_aCheckQueue;
 
+	protected static int s_iTimeout = 10000;
+
+	// Names of the registered await identifiers by handle, handle 0 is reserved as invalid
+	protected static ref array<string> s_aIdentifiers;
+	protected static ref map<string, int> s_mIdentifierHandles;
+
+	//------------------------------------------------------------------------------------------------
+	//! Set the time in ms after which a deferred apply is completed even if some of its awaited work never finished
+	//! \param timeout time in ms or 0 to wait forever
+	static void SetTimeout(int timeout)
+	{
+		s_iTimeout = timeout;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static int GetTimeout()
+	{
+		return s_iTimeout;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the handle for an await identifier to be passed to AddPending and SetFinished.
+	//! Register each identifier once, e.g. into a static field, so awaiting work involves no string lookups.
+	//! \param awaitIdentifier describes the awaited work, reported if it does not finish in time
+	//! \return handle, the same for every registration of the identifier
+	static int RegisterIdentifier(string awaitIdentifier)
+	{
+		if (!s_aIdentifiers)
+		{
+			s_aIdentifiers = {string.Empty};
+			s_mIdentifierHandles = new map<string, int>();
+		}
+
+		int handle = s_mIdentifierHandles.Get(awaitIdentifier);
+		if (handle == 0)
+		{
+			handle = s_aIdentifiers.Insert(awaitIdentifier);
+			s_mIdentifierHandles.Set(awaitIdentifier, handle);
+		}
+
+		return handle;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the await identifier registered for the handle
+	static string GetIdentifier(int awaitHandle)
+	{
+		if (!s_aIdentifiers || awaitHandle <= 0 || awaitHandle >= s_aIdentifiers.Count())
+			return string.Empty;
+
+		return s_aIdentifiers.Get(awaitHandle);
+	}
+
 	//------------------------------------------------------------------------------------------------
 	static bool IsPending(notnull EPF_EntitySaveData saveData)
 	{
@@ -25,63 +80,86 @@ class EPF_DeferredApplyResult
 	}
 
 	//------------------------------------------------------------------------------------------------
-	static void AddPending(notnull EPF_EntitySaveData saveData, string awaitIdentifier)
+	//! Await additional work before the entity counts as applied. Must be matched by exactly one SetFinished call with the same handle.
+	//! \param awaitHandle identifier of the awaited work, see RegisterIdentifier()
+	static void AddPending(notnull EPF_EntitySaveData saveData, int awaitHandle)
 	{
-		Print(string.Format("EPF_DeferredApplyResult.AddPending(%1, %2)", saveData, awaitIdentifier), LogLevel.VERBOSE);
+		#ifdef PERSISTENCE_DEBUG
+		Print(string.Format("EPF_DeferredApplyResult.AddPending(%1, %2)", saveData, GetIdentifier(awaitHandle)), LogLevel.VERBOSE);
+		#endif
 
 		EPF_PendingIdentifierHolder data = s_mPendingIdentifiers.Get(saveData);
 		if (!data)
 		{
-			data = new EPF_PendingIdentifierHolder({awaitIdentifier});
+			data = new EPF_PendingIdentifierHolder();
 			s_mPendingIdentifiers.Set(saveData, data);
-			return;
+			StartTimeoutCheck();
 		}
 
-		data.m_aIdentifiers.Insert(awaitIdentifier);
+		data.Add(awaitHandle);
 	}
 
 	//------------------------------------------------------------------------------------------------
-	static void AddPending(notnull EPF_ComponentSaveData componentSaveData, string awaitIdentifier)
+	//! See AddPending(EPF_EntitySaveData, int)
+	static void AddPending(notnull EPF_ComponentSaveData componentSaveData, int awaitHandle)
 	{
-		Print(string.Format("EPF_DeferredApplyResult.AddPending(%1, %2)", componentSaveData, awaitIdentifier), LogLevel.VERBOSE);
+		#ifdef PERSISTENCE_DEBUG
+		Print(string.Format("EPF_DeferredApplyResult.AddPending(%1, %2)", componentSaveData, GetIdentifier(awaitHandle)), LogLevel.VERBOSE);
+		#endif
 
 		EPF_PendingComponentIdentifierHolder data = s_mPendingComponentIdentifiers.Get(componentSaveData);
 		if (!data)
 		{
-			data = EPF_PendingComponentIdentifierHolder({awaitIdentifier});
+			data = new EPF_PendingComponentIdentifierHolder();
 			s_mPendingComponentIdentifiers.Set(componentSaveData, data);
-			return;
 		}
 
-		data.m_aIdentifiers.Insert(awaitIdentifier);
+		data.Add(awaitHandle);
 	}
 
 	//------------------------------------------------------------------------------------------------
-	static void SetFinished(notnull EPF_EntitySaveData saveData, string awaitIdentifier)
+	//! Complete work awaited via AddPending with the same handle. Calls without a matching AddPending are ignored.
+	static void SetFinished(notnull EPF_EntitySaveData saveData, int awaitHandle)
 	{
-		Print(string.Format("EPF_DeferredApplyResult.SetFinished(%1, %2)", saveData, awaitIdentifier), LogLevel.VERBOSE);
+		#ifdef PERSISTENCE_DEBUG
+		Print(string.Format("EPF_DeferredApplyResult.SetFinished(%1, %2)", saveData, GetIdentifier(awaitHandle)), LogLevel.VERBOSE);
+		#endif
 
 		EPF_PendingIdentifierHolder data = s_mPendingIdentifiers.Get(saveData);
-		if (!data)
+		if (!data || data.m_iPending <= 0)
 			return;
 
-		data.m_aIdentifiers.RemoveItem(awaitIdentifier);
+		if (!data.Finish(awaitHandle))
+		{
+			Print(string.Format("Deferred apply of '%1:%2' is not awaiting '%3'. Finish ignored.",
+				saveData.Type(), saveData.GetId(), GetIdentifier(awaitHandle)), LogLevel.WARNING);
+			return;
+		}
 
-		if (data.m_aIdentifiers.IsEmpty())
+		if (data.m_iPending == 0)
 			QueueComplectionCheck(saveData);
 	}
 
 	//------------------------------------------------------------------------------------------------
-	static void SetFinished(notnull EPF_ComponentSaveData componentSaveData, string awaitIdentifier)
+	//! See SetFinished(EPF_EntitySaveData, int)
+	static void SetFinished(notnull EPF_ComponentSaveData componentSaveData, int awaitHandle)
 	{
-		Print(string.Format("EPF_DeferredApplyResult.SetFinished(%1, %2)", componentSaveData, awaitIdentifier), LogLevel.VERBOSE);
+		#ifdef PERSISTENCE_DEBUG
+		Print(string.Format("EPF_DeferredApplyResult.SetFinished(%1, %2)", componentSaveData, GetIdentifier(awaitHandle)), LogLevel.VERBOSE);
+		#endif
 
 		EPF_PendingComponentIdentifierHolder data = s_mPendingComponentIdentifiers.Get(componentSaveData);
-		if (!data)
+		if (!data || data.m_iPending <= 0)
+			return;
+
+		if (!data.Finish(awaitHandle))
+		{
+			Print(string.Format("Deferred apply of '%1' is not awaiting '%2'. Finish ignored.",
+				componentSaveData.Type(), GetIdentifier(awaitHandle)), LogLevel.WARNING);
 			return;
+		}
 
-		data.m_aIdentifiers.RemoveItem(awaitIdentifier);
-		if (!data.m_aIdentifiers.IsEmpty())
+		if (data.m_iPending > 0)
 			return;
 
 		if (data.m_pSaveData)
@@ -109,14 +187,12 @@ class EPF_DeferredApplyResult
 
 			if (!data)
 			{
-				data = new EPF_PendingIdentifierHolder(components: {componentSaveData});
+				data = new EPF_PendingIdentifierHolder();
 				s_mPendingIdentifiers.Set(entitySaveData, data);
-			}
-			else
-			{
-				data.m_aComponents.Insert(componentSaveData);
+				StartTimeoutCheck();
 			}
 
+			data.m_aComponents.Insert(componentSaveData);
 			return true;
 		}
 
@@ -143,17 +219,26 @@ class EPF_DeferredApplyResult
 		foreach (EPF_EntitySaveData saveData : s_aCheckQueue)
 		{
 			EPF_PendingIdentifierHolder data = s_mPendingIdentifiers.Get(saveData);
+			if (!data)
+			{
+				remove.Insert(saveData);
+				continue;
+			}
 
-			if (!data.m_aIdentifiers.IsEmpty())
+			if (data.m_iPending > 0)
 				continue;
 
 			bool completed = true;
 			foreach (EPF_ComponentSaveData componentSaveData : data.m_aComponents)
 			{
 				EPF_PendingComponentIdentifierHolder componentData = s_mPendingComponentIdentifiers.Get(componentSaveData);
-				if (!componentData.m_aIdentifiers.IsEmpty())
+				if (componentData && componentData.m_iPending > 0)
+				{
 					completed = false;
+					break;
+				}
 			}
+
 			if (!completed)
 				continue;
 
@@ -175,37 +260,134 @@ class EPF_DeferredApplyResult
 			s_aCheckQueue.RemoveItem(saveData);
 		}
 	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static void StartTimeoutCheck()
+	{
+		if (s_iTimeout <= 0)
+			return;
+
+		ScriptCallQueue callQueue = GetGame().GetCallqueue();
+		if (callQueue.GetRemainingTime(CheckForTimeouts) == -1)
+			callQueue.CallLater(CheckForTimeouts, TIMEOUT_CHECK_INTERVAL, true);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Force the completion of deferred applies that are awaiting work longer than the timeout
+	protected static void CheckForTimeouts()
+	{
+		if (s_mPendingIdentifiers.IsEmpty() || s_iTimeout <= 0)
+		{
+			GetGame().GetCallqueue().Remove(CheckForTimeouts);
+			return;
+		}
+
+		int now = System.GetTickCount();
+		foreach (EPF_EntitySaveData saveData, EPF_PendingIdentifierHolder data : s_mPendingIdentifiers)
+		{
+			if ((now - data.m_iStartTime) < s_iTimeout)
+				continue;
+
+			string stalled = data.GetPendingIdentifiers();
+			data.Clear();
+
+			foreach (EPF_ComponentSaveData componentSaveData : data.m_aComponents)
+			{
+				EPF_PendingComponentIdentifierHolder componentData = s_mPendingComponentIdentifiers.Get(componentSaveData);
+				if (!componentData || componentData.m_iPending <= 0)
+					continue;
+
+				if (stalled)
+					stalled += ", ";
+
+				stalled += string.Format("%1 (%2)", componentSaveData.Type(), componentData.GetPendingIdentifiers());
+				componentData.Clear();
+			}
+
+			Print(string.Format("Deferred apply of '%1:%2' did not complete within %3 ms and was forced. Stalled: %4",
+				saveData.Type(), saveData.GetId(), s_iTimeout, stalled), LogLevel.WARNING);
+
+			QueueComplectionCheck(saveData);
+		}
+	}
 }
 
-class EPF_PendingIdentifierHolder
+//! Counts the awaited work per identifier handle, so each SetFinished only completes work of its own kind
+class EPF_PendingIdentifierCounter
 {
-	ref array<string> m_aIdentifiers;
-	ref array<EPF_ComponentSaveData> m_aComponents;
-	ref ScriptInvoker<EPF_EntitySaveData> m_pOnAppliedEvent;
+	int m_iPending;
+	protected ref array<int> m_aPending = {};
 
-	void EPF_PendingIdentifierHolder(array<string> identifiers = null, array<EPF_ComponentSaveData> components = null)
+	//------------------------------------------------------------------------------------------------
+	void Add(int handle)
 	{
-		m_aIdentifiers = identifiers;
-		if (!m_aIdentifiers)
-			m_aIdentifiers = {};
+		// Only grows once per holder for the highest handle it awaits
+		if (handle >= m_aPending.Count())
+			m_aPending.Resize(handle + 1);
 
-		m_aComponents = components;
-		if (!m_aComponents)
-			m_aComponents = {};
+		m_aPending.Set(handle, m_aPending.Get(handle) + 1);
+		m_iPending++;
+	}
 
-		m_pOnAppliedEvent = new ScriptInvoker();
+	//------------------------------------------------------------------------------------------------
+	//! \return true if work with the handle was pending, false otherwise
+	bool Finish(int handle)
+	{
+		if (handle <= 0 || handle >= m_aPending.Count())
+			return false;
+
+		int count = m_aPending.Get(handle);
+		if (count <= 0)
+			return false;
+
+		m_aPending.Set(handle, count - 1);
+		m_iPending--;
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! \return comma separated identifiers of the unfinished work, with their count if awaited more than once
+	string GetPendingIdentifiers()
+	{
+		string result;
+		foreach (int handle, int count : m_aPending)
+		{
+			if (count <= 0)
+				continue;
+
+			if (result)
+				result += ", ";
+
+			result += EPF_DeferredApplyResult.GetIdentifier(handle);
+			if (count > 1)
+				result += string.Format(" x%1", count);
+		}
+
+		return result;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void Clear()
+	{
+		m_iPending = 0;
+		m_aPending.Clear();
 	}
 }
 
-class EPF_PendingComponentIdentifierHolder
+class EPF_PendingIdentifierHolder : EPF_PendingIdentifierCounter
 {
-	EPF_EntitySaveData m_pSaveData;
-	ref array<string> m_aIdentifiers;
+	int m_iStartTime;
+	ref array<EPF_ComponentSaveData> m_aComponents = {};
+	ref ScriptInvoker<EPF_EntitySaveData> m_pOnAppliedEvent = new ScriptInvoker();
 
-	void EPF_PendingComponentIdentifierHolder(array<string> identifiers = null)
+	//------------------------------------------------------------------------------------------------
+	void EPF_PendingIdentifierHolder()
 	{
-		m_aIdentifiers = identifiers;
-		if (!m_aIdentifiers)
-			m_aIdentifiers = {};
+		m_iStartTime = System.GetTickCount();
 	}
 }
+
+class EPF_PendingComponentIdentifierHolder : EPF_PendingIdentifierCounter
+{
+	EPF_EntitySaveData m_pSaveData;
+}
@@ -0,0 +1,208 @@
+//! Persistent root entities kept out of the world until a player comes close, indexed by grid cells around their position.
+class EPF_DormantEntityIndex
+{
+	protected float m_fCellSize;
+	protected ref map<int, ref array<ref EPF_DormantEntity>> m_mCells = new map<int, ref array<ref EPF_DormantEntity>>();
+	protected ref map<string, int> m_mEntityCells = new map<string, int>();
+
+	//------------------------------------------------------------------------------------------------
+	//! Add an entity to the index, replacing an existing entry with the same id
+	void Insert(notnull EPF_DormantEntity entity)
+	{
+		Remove(entity.m_sId);
+
+		int cellKey = GetCellKey(GetCellCoord(entity.m_vOrigin[0]), GetCellCoord(entity.m_vOrigin[2]));
+		array<ref EPF_DormantEntity> cell = m_mCells.Get(cellKey);
+		if (!cell)
+		{
+			cell = {};
+			m_mCells.Set(cellKey, cell);
+		}
+
+		cell.Insert(entity);
+		m_mEntityCells.Set(entity.m_sId, cellKey);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Take an entity out of the index
+	//! \return the removed entry or null if the id is not dormant
+	EPF_DormantEntity Remove(string persistentId)
+	{
+		int cellKey;
+		if (!m_mEntityCells.Find(persistentId, cellKey))
+			return null;
+
+		m_mEntityCells.Remove(persistentId);
+
+		array<ref EPF_DormantEntity> cell = m_mCells.Get(cellKey);
+		foreach (int idx, EPF_DormantEntity entity : cell)
+		{
+			if (entity.m_sId != persistentId)
+				continue;
+
+			cell.Remove(idx);
+			if (cell.IsEmpty())
+				m_mCells.Remove(cellKey);
+
+			return entity;
+		}
+
+		return null;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get an entity without taking it out of the index
+	EPF_DormantEntity Get(string persistentId)
+	{
+		int cellKey;
+		if (!m_mEntityCells.Find(persistentId, cellKey))
+			return null;
+
+		foreach (EPF_DormantEntity entity : m_mCells.Get(cellKey))
+		{
+			if (entity.m_sId == persistentId)
+				return entity;
+		}
+
+		return null;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	bool Contains(string persistentId)
+	{
+		return m_mEntityCells.Contains(persistentId);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	int Count()
+	{
+		return m_mEntityCells.Count();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Take all entities within the radius around a position out of the index
+	//! \param position center of the search, only the horizontal distance is considered
+	//! \param radius search radius in meters
+	//! \param outEntities receives the removed entries
+	void TakeNear(vector position, float radius, notnull array<ref EPF_DormantEntity> outEntities)
+	{
+		int cellRange = Math.Ceil(radius / m_fCellSize);
+		int centerX = GetCellCoord(position[0]);
+		int centerZ = GetCellCoord(position[2]);
+		float radiusSq = radius * radius;
+
+		for (int cellX = centerX - cellRange; cellX <= centerX + cellRange; cellX++)
+		{
+			for (int cellZ = centerZ - cellRange; cellZ <= centerZ + cellRange; cellZ++)
+			{
+				int cellKey = GetCellKey(cellX, cellZ);
+				array<ref EPF_DormantEntity> cell = m_mCells.Get(cellKey);
+				if (!cell)
+					continue;
+
+				for (int idx = cell.Count() - 1; idx >= 0; idx--)
+				{
+					EPF_DormantEntity entity = cell.Get(idx);
+					if (vector.DistanceSqXZ(entity.m_vOrigin, position) > radiusSq)
+						continue;
+
+					outEntities.Insert(entity);
+					m_mEntityCells.Remove(entity.m_sId);
+					cell.Remove(idx);
+				}
+
+				if (cell.IsEmpty())
+					m_mCells.Remove(cellKey);
+			}
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected int GetCellCoord(float worldCoord)
+	{
+		return Math.Floor(worldCoord / m_fCellSize);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static int GetCellKey(int cellX, int cellZ)
+	{
+		return (cellX << 16) | (cellZ & 0xFFFF);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! \param cellSize edge length of the grid cells in meters, ideally the radius used for TakeNear
+	void EPF_DormantEntityIndex(float cellSize)
+	{
+		m_fCellSize = Math.Max(cellSize, 1.0);
+	}
+}
+
+class EPF_DormantEntity
+{
+	string m_sId;
+	typename m_tSaveDataType;
+	vector m_vOrigin;
+
+	// Already loaded save-data or null if the entity has to be loaded from its database record
+	ref EPF_EntitySaveData m_pSaveData;
+}
+
+//! Dormant entities a player came close to, waiting to be spawned within the per frame budget
+class EPF_DormantSpawnQueue
+{
+	protected ref array<ref EPF_DormantEntity> m_aEntities = {};
+	protected ref set<string> m_aIds = new set<string>();
+	protected int m_iNextIdx;
+
+	//------------------------------------------------------------------------------------------------
+	void Insert(notnull EPF_DormantEntity entity)
+	{
+		if (m_aIds.Contains(entity.m_sId))
+			return;
+
+		m_aIds.Insert(entity.m_sId);
+		m_aEntities.Insert(entity);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Take the next entity out of the queue
+	//! \return entity or null if the queue is empty
+	EPF_DormantEntity Pop()
+	{
+		while (m_iNextIdx < m_aEntities.Count())
+		{
+			EPF_DormantEntity entity = m_aEntities.Get(m_iNextIdx);
+			m_aEntities.Set(m_iNextIdx++, null);
+
+			// Skip entries removed in the meantime
+			if (m_aIds.Contains(entity.m_sId))
+			{
+				m_aIds.RemoveItem(entity.m_sId);
+				return entity;
+			}
+		}
+
+		m_aEntities.Clear();
+		m_iNextIdx = 0;
+		return null;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Drop an entity from the queue, e.g. because it was spawned through other means
+	void Remove(string persistentId)
+	{
+		m_aIds.RemoveItem(persistentId);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	bool Contains(string persistentId)
+	{
+		return m_aIds.Contains(persistentId);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	bool IsEmpty()
+	{
+		return m_aIds.IsEmpty();
+	}
+}
@@ -19,6 +19,20 @@ class EPF_EntitySaveDataClass
 
 	[Attribute(desc: "Components to persist.")]
 	ref array<ref EPF_ComponentSaveDataClass> m_aComponents;
+
+	// Derived from shared initialization
+	ref EPF_EntitySaveDataPlan m_pPlan;
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the resolved read and apply plan shared by all entities using this configuration.
+	//! Built during persistence component initialization or on first use.
+	EPF_EntitySaveDataPlan GetPlan()
+	{
+		if (!m_pPlan)
+			m_pPlan = EPF_EntitySaveDataPlan.Create(this);
+
+		return m_pPlan;
+	}
 }
 
 class EPF_EntitySaveData : EPF_MetaDataDbEntity
@@ -28,6 +42,9 @@ class EPF_EntitySaveData : EPF_MetaDataDbEntity
 	float m_fRemainingLifetime;
 	ref array<ref EPF_PersistentComponentSaveData> m_aComponents;
 
+	[NonSerialized()]
+	EPF_ESaveDataPoolFlags m_ePoolFlags;
+
 	//------------------------------------------------------------------------------------------------
 	//! Spawn the world entity based on this save-data instance
 	//! \param isRoot true if the current entity is a world root (not a stored item inside a storage)
@@ -44,6 +61,10 @@ class EPF_EntitySaveData : EPF_MetaDataDbEntity
 	//! \return EPF_EReadResult.OK if save-data could be read, ERROR if something failed, NODATA for all default values
 	EPF_EReadResult ReadFrom(IEntity entity, EPF_EntitySaveDataClass attributes)
 	{
+		EPF_EntitySaveDataPlan plan = attributes.GetPlan();
+		if (!plan.m_bValid)
+			return EPF_EReadResult.ERROR;
+
 		EPF_EReadResult statusCode = EPF_EReadResult.DEFAULT;
 		if (!attributes.m_bTrimDefaults)
 			statusCode = EPF_EReadResult.OK;
@@ -55,7 +76,15 @@ class EPF_EntitySaveData : EPF_MetaDataDbEntity
 		m_rPrefab = EPF_Utils.GetPrefabName(entity);
 
 		// Transform
-		m_pTransformation = new EPF_PersistentTransformation();
+		if (m_pTransformation)
+		{
+			m_pTransformation.Reset();
+		}
+		else
+		{
+			m_pTransformation = new EPF_PersistentTransformation();
+		}
+
 		// We save it on root entities and always on characters (in case the parent vehicle is not loaded back in)
 		// We can skip transform for baked entities that were not moved.
 		EPF_EPersistenceFlags flags = persistenceComponent.GetFlags();
@@ -85,49 +114,57 @@ class EPF_EntitySaveData : EPF_MetaDataDbEntity
 		}
 
 		// Components
-		m_aComponents = {};
+		if (m_aComponents)
+		{
+			m_aComponents.Clear();
+		}
+		else
+		{
+			m_aComponents = {};
+		}
 
-		array<Managed> processedComponents();
+		// Ingore base class find machtes if a parent class was already processed. Only possible if the component types overlap.
+		set<Managed> processedComponents;
+		if (plan.m_bOverlappingComponentTypes)
+			processedComponents = new set<Managed>();
 
 		// Go through hierarchy sorted component types
-		foreach (EPF_ComponentSaveDataClass componentSaveDataClass : attributes.m_aComponents)
+		array<Managed> outComponents();
+		foreach (EPF_ComponentSaveDataPlanStep step : plan.m_aReadSteps)
 		{
-			typename saveDataType = EPF_Utils.TrimEnd(componentSaveDataClass.ClassName(), 5).ToType();
-			if (!saveDataType)
-			{
-				Debug.Error(string.Format("Component save-data class class '%1' is not implemented. Check that the save-data classes have the correct naming pattern.", componentSaveDataClass.ClassName()));
-				return EPF_EReadResult.ERROR;
-			}
-
-			array<Managed> outComponents();
-			entity.FindComponents(EPF_ComponentSaveDataType.Get(componentSaveDataClass.Type()), outComponents);
+			outComponents.Clear();
+			entity.FindComponents(step.m_tComponentType, outComponents);
 			foreach (Managed componentRef : outComponents)
 			{
-				// Ingore base class find machtes if a parent class was already processed
-				if (processedComponents.Contains(componentRef))
-					continue;
+				if (processedComponents)
+				{
+					if (processedComponents.Contains(componentRef))
+						continue;
 
-				processedComponents.Insert(componentRef);
+					processedComponents.Insert(componentRef);
+				}
 
-				EPF_ComponentSaveData componentSaveData = EPF_ComponentSaveData.Cast(saveDataType.Spawn());
+				EPF_ComponentSaveData componentSaveData = EPF_ComponentSaveData.Cast(EPF_SaveDataPool.Get(step.m_tSaveDataType));
 				if (!componentSaveData)
 				{
-					Debug.Error(string.Format("Failed to instantiate component save data class '%1'.", saveDataType.ToString()));
+					Debug.Error(string.Format("Failed to instantiate component save data class '%1'.", step.m_tSaveDataType.ToString()));
 					return EPF_EReadResult.ERROR;
 				}
 
-				componentSaveDataClass.m_bTrimDefaults = attributes.m_bTrimDefaults;
-				EPF_EReadResult componentRead = componentSaveData.ReadFrom(entity, GenericComponent.Cast(componentRef), componentSaveDataClass);
+				EPF_EReadResult componentRead = componentSaveData.ReadFrom(entity, GenericComponent.Cast(componentRef), step.m_pSettings);
 				if (componentRead == EPF_EReadResult.ERROR)
 				{
-					Debug.Error(string.Format("Failed to read save-data from component '%1' using '%2'.", componentRef.ClassName(), saveDataType.ToString()));
+					Debug.Error(string.Format("Failed to read save-data from component '%1' using '%2'.", componentRef.ClassName(), step.m_tSaveDataType.ToString()));
 					return componentRead;
 				}
 
 				if (componentRead == EPF_EReadResult.DEFAULT && attributes.m_bTrimDefaults)
+				{
+					EPF_SaveDataPool.Release(componentSaveData);
 					continue;
+				}
 
-				EPF_PersistentComponentSaveData persistentComponent();
+				EPF_PersistentComponentSaveData persistentComponent = EPF_PersistentComponentSaveData.Cast(EPF_SaveDataPool.Get(EPF_PersistentComponentSaveData));
 				persistentComponent.m_pData = componentSaveData;
 				m_aComponents.Insert(persistentComponent);
 			}
@@ -146,6 +183,10 @@ class EPF_EntitySaveData : EPF_MetaDataDbEntity
 	//! \return true if save-data could be applied, false if something failed.
 	EPF_EApplyResult ApplyTo(IEntity entity, EPF_EntitySaveDataClass attributes)
 	{
+		EPF_EntitySaveDataPlan plan = attributes.GetPlan();
+		if (!plan.m_bValid)
+			return EPF_EApplyResult.ERROR;
+
 		EPF_EApplyResult result = EPF_EApplyResult.OK;
 
 		// Transform
@@ -162,10 +203,10 @@ class EPF_EntitySaveData : EPF_MetaDataDbEntity
 
 		// Components
 		set<Managed> processedComponents();
-		set<typename> processedSaveDataTypes();
-		foreach (EPF_ComponentSaveDataClass componentSaveDataClass : attributes.m_aComponents)
+		array<Managed> outComponents();
+		foreach (EPF_ComponentSaveDataPlanStep step : plan.m_aApplySteps)
 		{
-			EPF_EApplyResult componentResult = ApplyComponent(componentSaveDataClass, entity, processedSaveDataTypes, processedComponents, attributes);
+			EPF_EApplyResult componentResult = ApplyStep(step, entity, processedComponents, outComponents);
 
 			if (componentResult == EPF_EApplyResult.ERROR)
 				return EPF_EApplyResult.ERROR;
@@ -176,7 +217,7 @@ class EPF_EntitySaveData : EPF_MetaDataDbEntity
 
 		// Update any non character entity. On character this can cause fall through ground.
 		if (!ChimeraCharacter.Cast(entity))
-			entity.Update();
+			EPF_WorldUtils.UpdateEntity(entity);
 
 		return result;
 	}
@@ -234,67 +275,89 @@ class EPF_EntitySaveData : EPF_MetaDataDbEntity
 	}
 
 	//------------------------------------------------------------------------------------------------
-	protected EPF_EApplyResult ApplyComponent(
-		EPF_ComponentSaveDataClass componentSaveDataClass,
-		IEntity entity,
-		set<typename> processedSaveDataTypes,
-		set<Managed> processedComponents,
-		EPF_EntitySaveDataClass attributes)
+	//! Count how often each prefab is used by this and all nested entities
+	//! \param outHistogram prefab usage counts to add to
+	void CollectPrefabs(notnull map<ResourceName, int> outHistogram)
 	{
-		EPF_EApplyResult result = EPF_EApplyResult.OK;
-
-		typename componentSaveDataType = EPF_Utils.TrimEnd(componentSaveDataClass.ClassName(), 5).ToType();
+		if (m_rPrefab)
+			outHistogram.Set(m_rPrefab, outHistogram.Get(m_rPrefab) + 1);
 
-		// Skip already processed save-data
-		if (processedSaveDataTypes.Contains(componentSaveDataType))
-			return result;
-
-		processedSaveDataTypes.Insert(componentSaveDataType);
+		if (!m_aComponents)
+			return;
 
-		// Make sure required save-data is already applied
-		array<typename> requiredSaveDataClasses = componentSaveDataClass.Requires();
-		if (requiredSaveDataClasses)
+		array<EPF_EntitySaveData> nested();
+		foreach (EPF_PersistentComponentSaveData persistentComponent : m_aComponents)
 		{
-			foreach (typename requiredSaveDataClass : requiredSaveDataClasses)
-			{
-				if (!requiredSaveDataClass.ToString().EndsWith("Class"))
-				{
-					Debug.Error(string.Format("Save-data class '%1' lists invalid (non xyzClass) requirement type '%2'. Fix or remove it.", componentSaveDataClass.Type().ToString(), requiredSaveDataClass));
-					return EPF_EApplyResult.ERROR;
-				}
+			if (persistentComponent.m_pData)
+				persistentComponent.m_pData.CollectNestedSaveData(nested);
+		}
 
-				foreach (EPF_ComponentSaveDataClass possibleComponentClass : attributes.m_aComponents)
-				{
-					if (possibleComponentClass == componentSaveDataClass ||
-						!possibleComponentClass.IsInherited(requiredSaveDataClass)) continue;
+		foreach (EPF_EntitySaveData nestedSaveData : nested)
+		{
+			nestedSaveData.CollectPrefabs(outHistogram);
+		}
+	}
 
-					EPF_EApplyResult componentResult = ApplyComponent(possibleComponentClass, entity, processedSaveDataTypes, processedComponents, attributes);
+	//------------------------------------------------------------------------------------------------
+	//! Reset hook for save-data pooling. Hands nested save-data back to the pool and clears the instance for reuse by ReadFrom.
+	//! Override if a derived type holds additional references that ReadFrom does not overwrite.
+	//! \return true if the instance can be reused, false if it has to be left to the garbage collector
+	bool Recycle()
+	{
+		m_rPrefab = ResourceName.Empty;
+		m_fRemainingLifetime = 0;
+		m_ePoolFlags = 0;
 
-					if (componentResult == EPF_EApplyResult.ERROR)
-						return EPF_EApplyResult.ERROR;
+		if (m_pTransformation)
+			m_pTransformation.m_bApplied = false;
 
-					if (componentResult == EPF_EApplyResult.AWAIT_COMPLETION)
-						result = EPF_EApplyResult.AWAIT_COMPLETION;
-				}
+		if (m_aComponents)
+		{
+			foreach (EPF_PersistentComponentSaveData persistentComponent : m_aComponents)
+			{
+				EPF_SaveDataPool.Release(persistentComponent.m_pData);
+				persistentComponent.m_pData = null;
+				EPF_SaveDataPool.Return(persistentComponent);
 			}
+
+			m_aComponents.Clear();
 		}
 
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected EPF_EApplyResult ApplyStep(
+		EPF_ComponentSaveDataPlanStep step,
+		IEntity entity,
+		set<Managed> processedComponents,
+		array<Managed> outComponents)
+	{
+		EPF_EApplyResult result = EPF_EApplyResult.OK;
+
 		// Apply save-data to matching components
-		array<Managed> outComponents();
-		entity.FindComponents(EPF_ComponentSaveDataType.Get(componentSaveDataClass.Type()), outComponents);
+		bool componentsFound;
 		foreach (EPF_PersistentComponentSaveData persistentComponentSaveData : m_aComponents)
 		{
 			EPF_ComponentSaveData componentSaveData = persistentComponentSaveData.m_pData;
 
-			if (componentSaveData.Type() != componentSaveDataType)
+			if (componentSaveData.Type() != step.m_tSaveDataType)
 				continue;
 
+			// Only look for components if there is any save-data for them
+			if (!componentsFound)
+			{
+				outComponents.Clear();
+				entity.FindComponents(step.m_tComponentType, outComponents);
+				componentsFound = true;
+			}
+
 			bool applied = false;
 			foreach (Managed componentRef : outComponents)
 			{
-				if (!processedComponents.Contains(componentRef) && componentSaveData.IsFor(entity, GenericComponent.Cast(componentRef), componentSaveDataClass))
+				if (!processedComponents.Contains(componentRef) && componentSaveData.IsFor(entity, GenericComponent.Cast(componentRef), step.m_pSettings))
 				{
-					EPF_EApplyResult componentResult = componentSaveData.ApplyTo(entity, GenericComponent.Cast(componentRef), componentSaveDataClass);
+					EPF_EApplyResult componentResult = componentSaveData.ApplyTo(entity, GenericComponent.Cast(componentRef), step.m_pSettings);
 
 					if (componentResult == EPF_EApplyResult.ERROR)
 						return EPF_EApplyResult.ERROR;
@@ -334,7 +397,7 @@ class EPF_EntitySaveData : EPF_MetaDataDbEntity
 		string prefabString = m_rPrefab;
 		#ifndef PERSISTENCE_DEBUG
 		if (prefabString.StartsWith("{")) //keep this solution even though as of 1.0.0.95 it would be saved as just GUID anyway
-			prefabString = EPF_Utils.GetPrefabGUID(m_rPrefab);
+			prefabString = EPF_PrefabCatalog.GetPrefabGUID(m_rPrefab);
 		#endif
 		saveContext.WriteValue("m_rPrefab", prefabString);
 
@@ -524,7 +587,18 @@ class EPF_PersistentComponentSaveData
 			return false;
 
 		saveContext.WriteValue("_type", EDF_DbName.Get(m_pData.Type()));
-		saveContext.WriteValue("m_pData", m_pData);
+
+		EPF_ComponentSaveDataSerializer encoder = EPF_ComponentSaveDataSerializerType.GetEncoder(m_pData.Type());
+		if (encoder)
+		{
+			saveContext.StartObject("m_pData");
+			encoder.Encode(m_pData, saveContext);
+			saveContext.EndObject();
+		}
+		else
+		{
+			saveContext.WriteValue("m_pData", m_pData);
+		}
 
 		return true;
 	}
@@ -543,7 +617,18 @@ class EPF_PersistentComponentSaveData
 			return false;
 
 		m_pData = EPF_ComponentSaveData.Cast(dataType.Spawn());
-		loadContext.ReadValue("m_pData", m_pData);
+
+		EPF_ComponentSaveDataSerializer encoder = EPF_ComponentSaveDataSerializerType.GetEncoder(dataType);
+		if (encoder)
+		{
+			loadContext.StartObject("m_pData");
+			encoder.Decode(m_pData, loadContext);
+			loadContext.EndObject();
+		}
+		else
+		{
+			loadContext.ReadValue("m_pData", m_pData);
+		}
 
 		return true;
 	}
@@ -0,0 +1,121 @@
+//! Save and apply steps resolved once from the shared save-data configuration of a prefab.
+//! Avoids repeated typename lookups, string operations and dependency resolution per entity.
+class EPF_EntitySaveDataPlan
+{
+	// Component steps in inheritance sorted order used to read the save-data
+	ref array<ref EPF_ComponentSaveDataPlanStep> m_aReadSteps = {};
+
+	// The same steps ordered so every step comes after the steps it requires
+	ref array<EPF_ComponentSaveDataPlanStep> m_aApplySteps = {};
+
+	// True if one component type of the plan inherits from another, so the same component can be found by multiple steps
+	bool m_bOverlappingComponentTypes;
+
+	// False if the configuration could not be resolved. Read and apply will fail.
+	bool m_bValid = true;
+
+	//------------------------------------------------------------------------------------------------
+	//! Resolve the plan for the given save-data configuration. The component save-data classes are expected to be already sorted by inheritance.
+	static EPF_EntitySaveDataPlan Create(notnull EPF_EntitySaveDataClass attributes)
+	{
+		EPF_EntitySaveDataPlan plan();
+		if (!attributes.m_aComponents)
+			return plan;
+
+		plan.m_aReadSteps.Reserve(attributes.m_aComponents.Count());
+		foreach (EPF_ComponentSaveDataClass componentSaveDataClass : attributes.m_aComponents)
+		{
+			typename saveDataType = EPF_Utils.TrimEnd(componentSaveDataClass.ClassName(), 5).ToType();
+			if (!saveDataType)
+			{
+				Debug.Error(string.Format("Component save-data class class '%1' is not implemented. Check that the save-data classes have the correct naming pattern.", componentSaveDataClass.ClassName()));
+				plan.m_bValid = false;
+				return plan;
+			}
+
+			// "Inherited" attribute value from parent save data
+			componentSaveDataClass.m_bTrimDefaults = attributes.m_bTrimDefaults;
+
+			EPF_ComponentSaveDataPlanStep step();
+			step.m_pSettings = componentSaveDataClass;
+			step.m_tSaveDataType = saveDataType;
+			step.m_tComponentType = EPF_ComponentSaveDataType.Get(componentSaveDataClass.Type());
+			plan.m_aReadSteps.Insert(step);
+		}
+
+		foreach (int idx, EPF_ComponentSaveDataPlanStep step : plan.m_aReadSteps)
+		{
+			if (!step.m_tComponentType)
+				continue;
+
+			for (int compareIdx = idx + 1, count = plan.m_aReadSteps.Count(); compareIdx < count; compareIdx++)
+			{
+				typename otherComponentType = plan.m_aReadSteps.Get(compareIdx).m_tComponentType;
+				if (!otherComponentType)
+					continue;
+
+				if (step.m_tComponentType.IsInherited(otherComponentType) || otherComponentType.IsInherited(step.m_tComponentType))
+					plan.m_bOverlappingComponentTypes = true;
+			}
+		}
+
+		plan.m_aApplySteps.Reserve(plan.m_aReadSteps.Count());
+		set<typename> processedSaveDataTypes();
+		foreach (EPF_ComponentSaveDataPlanStep step : plan.m_aReadSteps)
+		{
+			if (!plan.AddApplyStep(step, processedSaveDataTypes))
+			{
+				plan.m_bValid = false;
+				break;
+			}
+		}
+
+		return plan;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Add the step to the apply order after all steps it requires.
+	protected bool AddApplyStep(EPF_ComponentSaveDataPlanStep step, set<typename> processedSaveDataTypes)
+	{
+		// Skip already processed save-data
+		if (processedSaveDataTypes.Contains(step.m_tSaveDataType))
+			return true;
+
+		processedSaveDataTypes.Insert(step.m_tSaveDataType);
+
+		// Make sure required save-data is applied first
+		array<typename> requiredSaveDataClasses = step.m_pSettings.Requires();
+		if (requiredSaveDataClasses)
+		{
+			foreach (typename requiredSaveDataClass : requiredSaveDataClasses)
+			{
+				if (!requiredSaveDataClass.ToString().EndsWith("Class"))
+				{
+					Debug.Error(string.Format("Save-data class '%1' lists invalid (non xyzClass) requirement type '%2'. Fix or remove it.", step.m_pSettings.Type().ToString(), requiredSaveDataClass));
+					return false;
+				}
+
+				foreach (EPF_ComponentSaveDataPlanStep possibleStep : m_aReadSteps)
+				{
+					if (possibleStep == step ||
+						!possibleStep.m_pSettings.IsInherited(requiredSaveDataClass)) continue;
+
+					if (!AddApplyStep(possibleStep, processedSaveDataTypes))
+						return false;
+				}
+			}
+		}
+
+		m_aApplySteps.Insert(step);
+		return true;
+	}
+}
+
+class EPF_ComponentSaveDataPlanStep
+{
+	// Owned by the save-data configuration the plan was built for
+	EPF_ComponentSaveDataClass m_pSettings;
+
+	typename m_tSaveDataType;
+	typename m_tComponentType;
+}
@@ -1,7 +1,5 @@
 class EPF_EntitySlotPrefabInfo
 {
-	protected static ref map<string, ref array<ref EPF_EntitySlotPrefabInfo>> s_mSlotInfoCache;
-
 	string m_sName;
 	string m_sPivotId;
 	vector m_vOffset;
@@ -22,21 +20,11 @@ class EPF_EntitySlotPrefabInfo
 	//------------------------------------------------------------------------------------------------
 	static array<ref EPF_EntitySlotPrefabInfo> GetSlotInfos(notnull IEntity owner, notnull SlotManagerComponent slotManager)
 	{
-		string key = EPF_Utils.GetPrefabOrMapName(owner);
-		array<ref EPF_EntitySlotPrefabInfo> infos;
-		if (s_mSlotInfoCache)
-		{
-			infos = s_mSlotInfoCache.Get(key);
-		}
-		else
-		{
-			s_mSlotInfoCache = new map<string, ref array<ref EPF_EntitySlotPrefabInfo>>();
-		}
+		EPF_PrefabCatalogEntry catalogEntry = EPF_PrefabCatalog.Get(EPF_Utils.GetPrefabOrMapName(owner));
+		if (catalogEntry.m_aSlotInfos)
+			return catalogEntry.m_aSlotInfos;
 
-		if (infos)
-			return infos;
-
-		infos = {};
+		array<ref EPF_EntitySlotPrefabInfo> infos();
 		BaseContainerList slots = slotManager.GetComponentSource(owner).GetObjectArray("Slots");
 
 		int slotsCount = slots.Count();
@@ -63,7 +51,8 @@ class EPF_EntitySlotPrefabInfo
 			infos.Insert(new EPF_EntitySlotPrefabInfo(slot.GetName(), pivotId, offset, angles, prefab, enabled));
 		}
 
-		s_mSlotInfoCache.Set(key, infos);
+		catalogEntry.m_aSlotInfos = infos;
+		EPF_PrefabCatalog.MarkDirty();
 
 		return infos;
 	}
@@ -111,13 +100,7 @@ class EPF_EntitySlotPrefabInfo
 	}
 
 	//------------------------------------------------------------------------------------------------
-	static void Reset()
-	{
-		s_mSlotInfoCache = null;
-	}
-
-	//------------------------------------------------------------------------------------------------
-	protected void EPF_EntitySlotPrefabInfo(
+	void EPF_EntitySlotPrefabInfo(
 		string name = string.Empty,
 		string pivotId = string.Empty,
 		vector offset = vector.Zero,
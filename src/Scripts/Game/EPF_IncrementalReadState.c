@@ -0,0 +1,125 @@
+//! Reads the nested persistent entities of a large root entity over multiple ticks, deepest first.
+//! Each result is kept on the nested persistence component until a Save() call made while this state is reading consumes it,
+//! so reading the root itself afterwards only needs to read its own components.
+//! Results are discarded if the entity or its parents change their slot in the meantime, see EPF_PersistenceComponent.InvalidatePreRead().
+class EPF_IncrementalReadState
+{
+	protected EPF_PersistenceComponent m_pRoot;
+	protected ref array<EPF_PersistenceComponent> m_aNested;
+	protected int m_iNextIdx;
+	protected bool m_bReading;
+
+	//------------------------------------------------------------------------------------------------
+	//! Collect the nested entities of the root
+	//! \param root persistence component of the root entity
+	//! \param threshold minimum number of nested persistent entities for the incremental read to be worth it
+	//! \return state or null if the root has not enough nested entities
+	static EPF_IncrementalReadState Create(notnull EPF_PersistenceComponent root, int threshold)
+	{
+		IEntity owner = root.GetOwner();
+		if (!owner || !owner.GetChildren())
+			return null;
+
+		array<EPF_PersistenceComponent> nested();
+		CollectNested(owner, nested);
+		if (nested.Count() <= threshold)
+			return null;
+
+		EPF_IncrementalReadState state();
+		state.m_pRoot = root;
+		state.m_aNested = nested;
+		return state;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	EPF_PersistenceComponent GetRoot()
+	{
+		return m_pRoot;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Check if Save() calls are currently made by this read, so they may use the pre-read results
+	bool IsReading()
+	{
+		return m_bReading;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Read the next batch of nested entities
+	//! \param budget maximum number of entities to read
+	//! \return true once all nested entities were read and the root can be saved via SaveRoot()
+	bool Step(int budget)
+	{
+		m_bReading = true;
+
+		int count = m_aNested.Count();
+		while (m_iNextIdx < count)
+		{
+			if (budget-- <= 0)
+			{
+				m_bReading = false;
+				return false;
+			}
+
+			EPF_PersistenceComponent persistence = m_aNested.Get(m_iNextIdx++);
+
+			// Skip entities that were deleted or became their own root in the meantime
+			if (!persistence ||
+				EPF_BitFlags.CheckFlags(persistence.GetFlags(), EPF_EPersistenceFlags.ROOT | EPF_EPersistenceFlags.PAUSE_TRACKING))
+			{
+				continue;
+			}
+
+			persistence.PreRead(this);
+		}
+
+		m_bReading = false;
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Save the root entity using the results read ahead by Step()
+	//! \return the save-data instance returned by EPF_PersistenceComponent.Save()
+	EPF_EntitySaveData SaveRoot()
+	{
+		if (!m_pRoot)
+			return null;
+
+		m_bReading = true;
+		EPF_EntitySaveData saveData = m_pRoot.Save();
+		m_bReading = false;
+		return saveData;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Discard read results that were not consumed by the root, e.g. because the entity left the hierarchy in the meantime.
+	void Finish()
+	{
+		foreach (EPF_PersistenceComponent persistence : m_aNested)
+		{
+			if (persistence)
+				persistence.DiscardPreRead();
+		}
+
+		m_aNested = null;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Collect persistent non root children in post-order, so nested entities come before the entities containing them.
+	protected static void CollectNested(IEntity entity, array<EPF_PersistenceComponent> outNested)
+	{
+		IEntity child = entity.GetChildren();
+		while (child)
+		{
+			// Children without persistence or their own root records are not read through this hierarchy
+			EPF_PersistenceComponent persistence = EPF_Component<EPF_PersistenceComponent>.Find(child);
+			if (persistence && !EPF_BitFlags.CheckFlags(persistence.GetFlags(), EPF_EPersistenceFlags.ROOT))
+			{
+				CollectNested(child, outNested);
+				outNested.Insert(persistence);
+			}
+
+			child = child.GetSibling();
+		}
+	}
+}
@@ -56,6 +56,35 @@
 	[NonSerialized()]
 	private static ref map<EPF_PersistenceComponent, ref EPF_EntitySaveData> m_mLastSaveData;
 
+	// Cached handles for the save path, see GetSettings(), GetParentPersistence(), GetStorages() and GetStorageManager()
+	[NonSerialized()]
+	private EPF_PersistenceComponentClass m_pSettings;
+
+	[NonSerialized()]
+	private IEntity m_pParentEntity;
+
+	[NonSerialized()]
+	private EPF_PersistenceComponent m_pParentPersistence;
+
+	[NonSerialized()]
+	private ref array<BaseInventoryStorageComponent> m_aStorages;
+
+	[NonSerialized()]
+	private InventoryStorageManagerComponent m_pStorageManager;
+
+	// Result of PreRead() to be returned by the next Save() call of the same incremental read
+	[NonSerialized()]
+	private ref EPF_EntitySaveData m_pPreReadSaveData;
+
+	[NonSerialized()]
+	private EPF_EReadResult m_ePreReadResult;
+
+	[NonSerialized()]
+	private EPF_IncrementalReadState m_pPreReadState;
+
+	[NonSerialized()]
+	private int m_iPreReadGeneration;
+
 	//------------------------------------------------------------------------------------------------
 	//! static helper see GetPersistentId()
 	static string GetPersistentId(IEntity entity)
@@ -102,6 +131,49 @@
 		return m_eFlags;
 	}
 
+	//------------------------------------------------------------------------------------------------
+	//! Get the shared prefab settings of the persistence component
+	EPF_PersistenceComponentClass GetSettings()
+	{
+		if (!m_pSettings)
+			m_pSettings = EPF_PersistenceComponentClass.Cast(GetComponentData(GetOwner()));
+
+		return m_pSettings;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the persistence component of the parent entity in the hierarchy
+	//! \return parent persistence or null if there is no parent or it is not persistent
+	EPF_PersistenceComponent GetParentPersistence()
+	{
+		IEntity parent = GetOwner().GetParent();
+		if (parent != m_pParentEntity)
+			CacheParent(parent);
+
+		return m_pParentPersistence;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get all inventory storage components on the entity
+	array<BaseInventoryStorageComponent> GetStorages()
+	{
+		if (!m_aStorages)
+			CacheInventoryHandles();
+
+		return m_aStorages;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the inventory storage manager component on the entity
+	//! \return storage manager or null if the entity has none
+	InventoryStorageManagerComponent GetStorageManager()
+	{
+		if (!m_aStorages)
+			CacheInventoryHandles();
+
+		return m_pStorageManager;
+	}
+
 	//------------------------------------------------------------------------------------------------
 	//! Event invoker for when the save-data was read but was not yet persisted to the database.
 	//! Args(EPF_PersistenceComponent, EPF_EntitySaveData)
@@ -159,6 +231,23 @@
 	//! \return the save-data instance that was submitted to the database
 	EPF_EntitySaveData Save(out EPF_EReadResult readResult = EPF_EReadResult.ERROR)
 	{
+		// Already read ahead by an incremental read of the parent hierarchy.
+		// Only that read may use the result, and only if nothing was moved in or out of the entity since.
+		if (m_pPreReadSaveData)
+		{
+			if (m_pPreReadState && m_pPreReadState.IsReading() &&
+				!EPF_StorageChangeDetection.HasChangedSince(GetOwner(), m_iPreReadGeneration))
+			{
+				EPF_EntitySaveData preReadSaveData = m_pPreReadSaveData;
+				m_pPreReadSaveData = null;
+				m_pPreReadState = null;
+				readResult = m_ePreReadResult;
+				return preReadSaveData;
+			}
+
+			DiscardPreRead();
+		}
+
 		GetPersistentId(); // Make sure the id has been assigned
 
 		m_iLastSaved = System.GetUnixTime();
@@ -170,8 +259,8 @@
 			return null;
 		}
 		
-		EPF_PersistenceComponentClass settings = EPF_PersistenceComponentClass.Cast(GetComponentData(owner));
-		EPF_EntitySaveData saveData = EPF_EntitySaveData.Cast(settings.m_tSaveDataType.Spawn());
+		EPF_PersistenceComponentClass settings = GetSettings();
+		EPF_EntitySaveData saveData = EPF_SaveDataPool.GetEntitySaveData(settings.m_tSaveDataType);
 		
 		if (saveData)
 			readResult = saveData.ReadFrom(owner, settings.m_pSaveData);
@@ -205,7 +294,14 @@
 
 			if (!isPersistent || !lastData || !lastData.Equals(saveData))
 			{
+				// Retain before submitting, so the instance is never recycled while the change tracker holds it
+				if (settings.m_bUseChangeTracker)
+					SetLastSaveData(saveData);
+
 				persistenceManager.AddOrUpdateAsync(saveData);
+				if (!isPersistent)
+					persistenceManager.UpdateBakedRecord(this, m_sId, true);
+
 				EPF_BitFlags.SetFlags(m_eFlags, EPF_EPersistenceFlags.PERSISTENT_RECORD);
 				wasPersisted = true;
 			}
@@ -216,11 +312,12 @@
 			// The save-data will be present inside the storage parent instead.
 			// Remove immediately so that on e.g. a web driver there is no delete call coming for an id that was previously saved as child
 			persistenceManager.RemoveAsync(settings.m_tSaveDataType, m_sId);
+			persistenceManager.UpdateBakedRecord(this, m_sId, false);
 			EPF_BitFlags.ClearFlags(m_eFlags, EPF_EPersistenceFlags.PERSISTENT_RECORD);
 		}
 
 		if (settings.m_bUseChangeTracker)
-			m_mLastSaveData.Set(this, saveData);
+			SetLastSaveData(saveData);
 
 		if (m_pOnAfterPersist && wasPersisted)
 			m_pOnAfterPersist.Invoke(this, saveData);
@@ -228,12 +325,56 @@
 		return saveData;
 	}
 
+	//------------------------------------------------------------------------------------------------
+	//! Discard the pre-read save-data of this entity and all entities it is stored in, so the next save reads it again.
+	void InvalidatePreRead()
+	{
+		EPF_PersistenceComponent persistence = this;
+		while (persistence)
+		{
+			persistence.DiscardPreRead();
+			persistence = persistence.GetParentPersistence();
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Read the save-data ahead of time. The result is returned by the next Save() call made while the incremental read is reading,
+	//! instead of reading again. Used by EPF_IncrementalReadState to spread the read of large entity hierarchies over multiple ticks.
+	void PreRead(notnull EPF_IncrementalReadState state)
+	{
+		DiscardPreRead();
+
+		EPF_EReadResult readResult;
+		EPF_EntitySaveData saveData = Save(readResult);
+		if (!saveData)
+			return;
+
+		m_pPreReadSaveData = saveData;
+		m_ePreReadResult = readResult;
+		m_pPreReadState = state;
+		m_iPreReadGeneration = EPF_StorageChangeDetection.GetGeneration(GetOwner());
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Drop the result of PreRead() if it was not consumed by Save()
+	void DiscardPreRead()
+	{
+		m_pPreReadState = null;
+		if (!m_pPreReadSaveData)
+			return;
+
+		EPF_SaveDataPool.Release(m_pPreReadSaveData);
+		m_pPreReadSaveData = null;
+	}
+
 	//------------------------------------------------------------------------------------------------
 	//! Load existing save-data to apply to this entity
 	//! \param saveData existing data to restore the entity state from
 	//! \param isRoot true if the current entity is a world root (not a stored item inside a storage)
 	bool Load(notnull EPF_EntitySaveData saveData, bool isRoot = true)
 	{
+		InvalidatePreRead();
+
 		if (m_pOnBeforeLoad)
 			m_pOnBeforeLoad.Invoke(this, saveData);
 
@@ -259,7 +400,7 @@
 		SetPersistentId(saveData.GetId());
 
 		IEntity owner = GetOwner();
-		EPF_PersistenceComponentClass settings = EPF_PersistenceComponentClass.Cast(GetComponentData(owner));
+		EPF_PersistenceComponentClass settings = GetSettings();
 		EPF_EApplyResult applyResult = saveData.ApplyTo(owner, settings.m_pSaveData);
 		if (applyResult == EPF_EApplyResult.ERROR)
 		{
@@ -268,7 +409,7 @@
 		}
 
 		if (settings.m_bUseChangeTracker)
-			m_mLastSaveData.Set(this, saveData);
+			SetLastSaveData(saveData);
 
 		if (applyResult == EPF_EApplyResult.AWAIT_COMPLETION)
 		{
@@ -295,8 +436,9 @@
 		{
 			EPF_BitFlags.ClearFlags(m_eFlags, EPF_EPersistenceFlags.PERSISTENT_RECORD);
 			EPF_PersistenceManager persistenceManager = EPF_PersistenceManager.GetInstance();
-			EPF_PersistenceComponentClass settings = EPF_ComponentData<EPF_PersistenceComponentClass>.Get(GetOwner());
+			EPF_PersistenceComponentClass settings = GetSettings();
 			persistenceManager.RemoveAsync(settings.m_tSaveDataType, m_sId);
+			persistenceManager.UpdateBakedRecord(this, m_sId, false);
 		}
 
 		m_sId = string.Empty;
@@ -315,7 +457,7 @@
 			return;
 
 		// Init and validate settings on shared class-class instance once
-		EPF_PersistenceComponentClass settings = EPF_PersistenceComponentClass.Cast(GetComponentData(owner));
+		EPF_PersistenceComponentClass settings = GetSettings();
 		if (!settings.m_tSaveDataType)
 		{
 			if (!settings.m_pSaveData || settings.m_pSaveData.Type() == EPF_EntitySaveDataClass)
@@ -362,6 +504,9 @@
 			}
 			settings.m_pSaveData.m_aComponents = sortedComponents;
 
+			// Resolve the read and apply steps once for all entities of this prefab
+			settings.m_pSaveData.m_pPlan = EPF_EntitySaveDataPlan.Create(settings.m_pSaveData);
+
 			if (settings.m_bUseChangeTracker && !m_mLastSaveData)
 				m_mLastSaveData = new map<EPF_PersistenceComponent, ref EPF_EntitySaveData>();
 		}
@@ -412,6 +557,8 @@
 		if (!EPF_PersistenceManager.IsPersistenceMaster())
 			return;
 
+		CacheParent(parent);
+
 		// TODO: Replace with subscribe to all parent slots after https://feedback.bistudio.com/T171945 is added.
 
 		// Delay by a frame so we can know the actual slots they are in
@@ -474,6 +621,10 @@
 	//------------------------------------------------------------------------------------------------
 	protected void OnParentSlotChanged(InventoryStorageSlot oldSlot, InventoryStorageSlot newSlot)
 	{
+		InvalidatePreRead();
+		InvalidateSlotOwner(oldSlot);
+		InvalidateSlotOwner(newSlot);
+
 		if (oldSlot)
 			OnParentRemoved(oldSlot);
 
@@ -484,6 +635,10 @@
 	//------------------------------------------------------------------------------------------------
 	protected void OnParentAdded(EntitySlotInfo newSlot)
 	{
+		// Read results of the entity and its new parents no longer match
+		DiscardPreRead();
+		InvalidateSlotOwner(newSlot);
+
 		// TODO: Remove this hack in 0.9.9, only needed because we manually trigger OnAddedToParent from OnPostInit
 		if (!EPF_BitFlags.CheckFlags(m_eFlags, EPF_EPersistenceFlags.ROOT))
 			return;
@@ -504,17 +659,22 @@
 				if (EPF_Utils.IsInstanceAnyInherited(storage, {EquipedLoadoutStorageComponent, BaseEquipmentStorageComponent, BaseEquipedWeaponStorageComponent}))
 					EPF_BitFlags.SetFlags(m_eFlags, EPF_EPersistenceFlags.WAS_EQUIPPED);
 
-				EPF_PersistenceComponent parentPersistence = EPF_Component<EPF_PersistenceComponent>.Find(parent);
-				if (persistenceManager.GetState() == EPF_EPersistenceManagerState.ACTIVE &&
-					parentPersistence && EPF_BitFlags.CheckFlags(parentPersistence.GetFlags(), EPF_EPersistenceFlags.BAKED))
+				if (persistenceManager.GetState() == EPF_EPersistenceManagerState.ACTIVE)
 				{
-					EPF_BakedStorageChange.OnAdded(this, newInvSlot);
+					if (parent != m_pParentEntity)
+						CacheParent(parent);
+
+					EPF_PersistenceComponent parentPersistence = m_pParentPersistence;
+					if (parentPersistence && EPF_BitFlags.CheckFlags(parentPersistence.GetFlags(), EPF_EPersistenceFlags.BAKED))
+						EPF_BakedStorageChange.OnAdded(this, newInvSlot);
+
+					EPF_StorageChangeDetection.MarkChanged(storage);
 				}
 			}
 		}
 
 		if (m_sId && !EPF_BitFlags.CheckFlags(m_eFlags, EPF_EPersistenceFlags.PAUSE_TRACKING))
-			persistenceManager.UpdateRootStatus(this, m_sId, EPF_ComponentData<EPF_PersistenceComponentClass>.Get(owner), false);
+			persistenceManager.UpdateRootStatus(this, m_sId, GetSettings(), false);
 	}
 
 	//------------------------------------------------------------------------------------------------
@@ -527,7 +687,11 @@
 			EPF_BitFlags.CheckFlags(m_eFlags, EPF_EPersistenceFlags.ROOT)) //Must have been non root, avoid event for remove from stuff like generic organizer layer entity
 			return;
 
-		EPF_PersistenceComponentClass settings = EPF_ComponentData<EPF_PersistenceComponentClass>.Get(owner);
+		// Read results of the entity and its former parents no longer match
+		DiscardPreRead();
+		InvalidateSlotOwner(oldSlot);
+
+		EPF_PersistenceComponentClass settings = GetSettings();
 		if (!settings.m_bStorageRoot)
 			return;
 
@@ -547,6 +711,7 @@
 				if (parentPersistence && EPF_BitFlags.CheckFlags(parentPersistence.GetFlags(), EPF_EPersistenceFlags.BAKED))
 				{
 					EPF_BakedStorageChange.OnRemoved(this, oldInvSlot);
+					EPF_StorageChangeDetection.MarkChanged(storage);
 				}
 				else
 				{
@@ -627,7 +792,7 @@
 			m_mLastSaveData.Remove(this);
 
 		// Clean up storages
-		EPF_StorageChangeDetection.Cleanup(owner);
+		EPF_StorageChangeDetection.Cleanup(owner, GetStorages());
 
 		// Check that we are not in session dtor phase
 		EPF_PersistenceManager persistenceManager = EPF_PersistenceManager.GetInstance(false);
@@ -636,7 +801,7 @@
 
 		persistenceManager.Unregister(this);
 
-		EPF_PersistenceComponentClass settings = EPF_PersistenceComponentClass.Cast(GetComponentData(owner));
+		EPF_PersistenceComponentClass settings = GetSettings();
 		if (m_sId && !EPF_BitFlags.CheckFlags(m_eFlags, EPF_EPersistenceFlags.PAUSE_TRACKING))
 		{
 			persistenceManager.UpdateRootEntityCollection(this, m_sId, false);
@@ -651,7 +816,7 @@
 	//! \return instance of the save-data or null if not found
 	Managed GetAttributeClass(typename saveDataClassType)
 	{
-		EPF_PersistenceComponentClass settings = EPF_PersistenceComponentClass.Cast(GetComponentData(GetOwner()));
+		EPF_PersistenceComponentClass settings = GetSettings();
 		if (!settings.m_pSaveData)
 			return null;
 
@@ -682,6 +847,9 @@
 	//------------------------------------------------------------------------------------------------
 	void FlagAsSelected()
 	{
+		if (!EPF_BitFlags.CheckFlags(m_eFlags, EPF_EPersistenceFlags.WAS_SELECTED))
+			InvalidatePreRead();
+
 		EPF_BitFlags.SetFlags(m_eFlags, EPF_EPersistenceFlags.WAS_SELECTED);
 	}
 
@@ -719,10 +887,45 @@
 			eventHandler.RemoveScriptHandler("OnCompartmentEntered", this, OnCompartmentEntered);
 	}
 
+	//------------------------------------------------------------------------------------------------
+	//! Discard the pre-read save-data of the entity owning the slot and all entities it is stored in
+	protected static void InvalidateSlotOwner(EntitySlotInfo slot)
+	{
+		if (!slot)
+			return;
+
+		EPF_PersistenceComponent persistence = EPF_Component<EPF_PersistenceComponent>.Find(slot.GetOwner());
+		if (persistence)
+			persistence.InvalidatePreRead();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void CacheParent(IEntity parent)
+	{
+		m_pParentEntity = parent;
+		m_pParentPersistence = EPF_Component<EPF_PersistenceComponent>.Find(parent);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void CacheInventoryHandles()
+	{
+		IEntity owner = GetOwner();
+		m_pStorageManager = InventoryStorageManagerComponent.Cast(owner.FindComponent(InventoryStorageManagerComponent));
+
+		array<Managed> outComponents();
+		owner.FindComponents(BaseInventoryStorageComponent, outComponents);
+		m_aStorages = {};
+		m_aStorages.Reserve(outComponents.Count());
+		foreach (Managed componentRef : outComponents)
+		{
+			m_aStorages.Insert(BaseInventoryStorageComponent.Cast(componentRef));
+		}
+	}
+
 	//------------------------------------------------------------------------------------------------
 	protected void DeferredApplyCallback(EPF_EntitySaveData saveData)
 	{
-		EPF_PersistenceComponentClass settings = EPF_PersistenceComponentClass.Cast(GetComponentData(GetOwner()));
+		EPF_PersistenceComponentClass settings = GetSettings();
 		if (settings.m_bUpdateNavmesh)
 			UpdateNavesh();
 
@@ -730,12 +933,27 @@
 			m_pOnAfterLoad.Invoke(this, saveData);
 	}
 
+	//------------------------------------------------------------------------------------------------
+	//! Keep save-data for change tracking and hand the previous instance over to whatever save-data still references it.
+	protected void SetLastSaveData(EPF_EntitySaveData saveData)
+	{
+		EPF_EntitySaveData lastData = m_mLastSaveData.Get(this);
+		if (lastData == saveData)
+			return;
+
+		if (lastData)
+			EPF_SaveDataPool.Unretain(lastData);
+
+		EPF_SaveDataPool.Retain(saveData);
+		m_mLastSaveData.Set(this, saveData);
+	}
+
 	//------------------------------------------------------------------------------------------------
 	protected void UpdateNavesh()
 	{
-		SCR_AIWorld aiworld = SCR_AIWorld.Cast(GetGame().GetAIWorld());
-		if (aiworld)
-			aiworld.RequestNavmeshRebuildEntity(GetOwner());
+		EPF_PersistenceManager persistenceManager = EPF_PersistenceManager.GetInstance();
+		if (persistenceManager)
+			persistenceManager.RequestNavmeshRebuild(GetOwner());
 	}
 
 	#ifdef WORKBENCH
@@ -72,7 +72,7 @@ class EPF_PersistenceIdGenerator : EDF_DbEntityIdGenerator
 			string type = EPF_Utils.GetPrefabName(entity);
 			if (type)
 			{
-				type = EPF_Utils.GetPrefabGUID(type);
+				type = EPF_PrefabCatalog.GetPrefabGUID(type);
 			}
 			else
 			{
@@ -9,6 +9,14 @@ enum EPF_EPersistenceManagerState
 
 class EPF_PersistenceManager
 {
+	protected static const int DORMANT_ENTITY_CHECK_INTERVAL = 1000;
+	protected static const int DEHYDRATION_CHECK_INTERVAL = 10000;
+	protected static const float BAKED_REMOVAL_CELL_SIZE = 128;
+	protected static const float NAVMESH_REBUILD_CELL_SIZE = 128;
+	protected static const int PRIORITY_LOAD_BANDS = 8;
+	protected static const float IDLE_VELOCITY_SQ = 0.01;
+	protected static const float IDLE_MOVE_DISTANCE_SQ = 0.25;
+
 	protected static ref EPF_PersistenceManager s_pInstance;
 
 	protected ref EPF_PersistenceManagerComponentClass m_pSettings;
@@ -44,14 +52,46 @@ class EPF_PersistenceManager
 	protected int m_iAutoSaveEntityCount;
 	protected int m_iAutoSaveScriptedStateIdx;
 	protected int m_iAutoSaveScriptedStateCount;
+	protected ref EPF_IncrementalReadState m_pIncrementalRead;
 	protected ref ScriptInvoker<EPF_PersistenceManager> m_pOnAutoSaveCompleteEvent;
 
+	// Prefab resources used more than once by the initial world load, kept loaded until its spawns are done
+	protected ref map<ResourceName, ref Resource> m_mPrefabResources;
+
+	// World snapshot filled by the shutdown save, see WriteWorldSnapshot()
+	protected ref EPF_WorldSnapshot m_pShutdownSnapshot;
+	protected int m_iSnapshotPendingWrites;
+	protected bool m_bSnapshotWriteFailed;
+	protected bool m_bSnapshotFileWritten;
+
+	// Entities kept out of the world until a player comes close
+	protected ref EPF_DormantEntityIndex m_pDormantEntities;
+	protected ref EPF_DormantSpawnQueue m_pDormantSpawnQueue;
+	protected ref map<string, ref EPF_IdleRoot> m_mIdleRoots;
+	protected ref EPF_DormantEntity m_pDehydrating;
+
 	// Extensions
 	protected ref array<EPF_PersistenceManagerExtensionBaseComponent> m_aExtensions;
+	protected ref array<EPF_PersistenceManagerExtensionBaseComponent> m_aPendingExtensions;
+	protected bool m_bStartingExtensions;
 
 	// Setup buffers, discarded after world init
 	protected ref map<string, EPF_PersistenceComponent> m_mBakedRoots;
-	protected int m_iPendingLoadTypes;
+	protected ref array<EPF_PersistenceComponent> m_aSetupBakedRemovals;
+	protected int m_iSetupBakedRemovalIdx;
+	protected ref array<ref EPF_PersistenceManagerLoadPage> m_aSetupLoadPages;
+	protected int m_iSetupLoadPageIdx;
+	protected int m_iSetupPriorityPageCount;
+	protected int m_iActiveLoads;
+	protected ref EPF_SetupSpawnQueue m_pSetupSpawnQueue;
+	protected ref EPF_SetupSpawnQueue m_pSetupDeferredSpawnQueue;
+	protected ref array<vector> m_aLoadHotspots;
+	protected bool m_bSetupLoaded;
+	protected int m_iSetupLoadTotal;
+	protected int m_iSetupLoaded;
+	protected ref map<ResourceName, int> m_mSetupPrefabHistogram;
+	protected ref EPF_WorldSnapshot m_pSetupSnapshot;
+	protected ref map<int, ref EPF_NavmeshRebuildArea> m_mSetupNavmeshRebuilds;
 
 	//------------------------------------------------------------------------------------------------
 	//! Check if current game instance is intended to run the persistence system. Only the mission host should do so.
@@ -103,8 +143,21 @@ class EPF_PersistenceManager
 		return m_eState;
 	}
 
+	//------------------------------------------------------------------------------------------------
+	//! Get the progress of the initial world load
+	//! \return value between 0 and 1, 1 once all entities were spawned or loaded
+	float GetSetupProgress()
+	{
+		if (m_eState > EPF_EPersistenceManagerState.SETUP || m_iSetupLoadTotal <= 0)
+			return 1.0;
+
+		float loaded = m_iSetupLoaded;
+		return Math.Clamp(loaded / m_iSetupLoadTotal, 0.0, 1.0);
+	}
+
 	//------------------------------------------------------------------------------------------------
 	//! Get the event invoker that can be subscribed to be notified about persistence manager state/phase changes.
+	//! During the SETUP state it is invoked again whenever the initial world load made progress, see GetSetupProgress().
 	ScriptInvoker GetOnStateChangeEvent()
 	{
 		if (!m_pOnStateChangeEvent)
@@ -142,6 +195,36 @@ class EPF_PersistenceManager
 		return m_pDbContext;
 	}
 
+	//------------------------------------------------------------------------------------------------
+	//! Check if an entity is currently kept out of the world until a player comes close
+	//! \param persistentId Persistent id of the entity
+	//! \return true if the entity is dormant and will be spawned later, false otherwise
+	bool IsDormant(string persistentId)
+	{
+		return m_pDormantEntities && (m_pDormantEntities.Contains(persistentId) || m_pDormantSpawnQueue.Contains(persistentId));
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the loaded resource of a prefab. During the initial world load resources of prefabs spawned repeatedly are kept for later calls.
+	//! \param prefab resource name of the prefab
+	//! \return resource, check IsValid() before use
+	Resource GetPrefabResource(ResourceName prefab)
+	{
+		Resource resource;
+		if (m_mPrefabResources)
+		{
+			resource = m_mPrefabResources.Get(prefab);
+			if (resource)
+				return resource;
+		}
+
+		resource = Resource.Load(prefab);
+		if (m_mPrefabResources && m_mSetupPrefabHistogram.Get(prefab) > 1 && resource.IsValid())
+			m_mPrefabResources.Set(prefab, resource);
+
+		return resource;
+	}
+
 	//------------------------------------------------------------------------------------------------
 	//! Used to spawn and correctly register an entity from save-data
 	//! \param saveData Save-data to spawn from
@@ -152,7 +235,14 @@ class EPF_PersistenceManager
 		if (!saveData || !saveData.GetId())
 			return null;
 
-		Resource resource = Resource.Load(saveData.m_rPrefab);
+		// Spawned through other means (e.g. EPF_PersistentWorldEntityLoader) before a player came close
+		if (isRoot && m_pDormantEntities)
+		{
+			m_pDormantEntities.Remove(saveData.GetId());
+			m_pDormantSpawnQueue.Remove(saveData.GetId());
+		}
+
+		Resource resource = GetPrefabResource(saveData.m_rPrefab);
 		if (!resource.IsValid())
 		{
 			Debug.Error(string.Format("Invalid prefab type '%1' on '%2:%3' could not be spawned. Ignored.", saveData.m_rPrefab, saveData.Type().ToString(), saveData.GetId()));
@@ -339,9 +429,32 @@ class EPF_PersistenceManager
 			if (EPF_BitFlags.CheckFlags(persistenceComponent.GetFlags(), EPF_EPersistenceFlags.PAUSE_TRACKING))
 				continue;
 
-			persistenceComponent.Save();
+			// Large hierarchies read their nested entities over multiple ticks first
+			if ((m_eState == EPF_EPersistenceManagerState.ACTIVE) && !PrepareIncrementalRead(persistenceComponent))
+			{
+				m_iAutoSaveEntityIdx--; // Revisit the same root on the next tick
+				return;
+			}
+
+			EPF_EntitySaveData saveData;
+			if (m_pIncrementalRead && m_pIncrementalRead.GetRoot() == persistenceComponent)
+			{
+				saveData = m_pIncrementalRead.SaveRoot();
+			}
+			else
+			{
+				saveData = persistenceComponent.Save();
+			}
+
+			if (m_pShutdownSnapshot)
+				AddWorldSnapshotEntity(persistenceComponent, saveData);
+
+			// Anything not submitted to the database can be reused right away
+			EPF_SaveDataPool.Release(saveData);
 			m_iSaveOperation++;
 
+			FinishIncrementalRead();
+
 			if ((m_eState == EPF_EPersistenceManagerState.ACTIVE) &&
 				((m_iSaveOperation + 1) % m_pSettings.m_iAutosaveIterations == 0))
 			{
@@ -368,6 +481,9 @@ class EPF_PersistenceManager
 			}
 		}
 
+		FinishIncrementalRead();
+
+		StoreLoadHotspots();
 		m_pRootEntityCollection.Save(m_pDbContext);
 
 		// Remove records about former root enties that were not purged by a persistent parent's recursive save.
@@ -389,6 +505,38 @@ class EPF_PersistenceManager
 			m_pOnAutoSaveCompleteEvent.Invoke(this);
 	}
 
+	//------------------------------------------------------------------------------------------------
+	//! Read the nested entities of the root in batches if it has more than fit into a single tick.
+	//! \return true if the root can be saved now, false if the nested entities are still being read
+	protected bool PrepareIncrementalRead(notnull EPF_PersistenceComponent persistenceComponent)
+	{
+		int budget = m_pSettings.m_iMaxNestedReadsPerTick;
+		if (budget <= 0)
+			return true;
+
+		if (!m_pIncrementalRead || m_pIncrementalRead.GetRoot() != persistenceComponent)
+		{
+			// Previous root was deleted before it could be saved
+			FinishIncrementalRead();
+
+			m_pIncrementalRead = EPF_IncrementalReadState.Create(persistenceComponent, budget);
+			if (!m_pIncrementalRead)
+				return true;
+		}
+
+		return m_pIncrementalRead.Step(budget);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void FinishIncrementalRead()
+	{
+		if (!m_pIncrementalRead)
+			return;
+
+		m_pIncrementalRead.Finish();
+		m_pIncrementalRead = null;
+	}
+
 	//------------------------------------------------------------------------------------------------
 	protected void ShutDownSave()
 	{
@@ -401,7 +549,11 @@ class EPF_PersistenceManager
 			if (!persistenceComponent || EPF_BitFlags.CheckFlags(persistenceComponent.GetFlags(), EPF_EPersistenceFlags.PAUSE_TRACKING))
 				continue;
 
-			persistenceComponent.Save();
+			EPF_EntitySaveData saveData = persistenceComponent.Save();
+			if (m_pShutdownSnapshot)
+				AddWorldSnapshotEntity(persistenceComponent, saveData);
+
+			EPF_SaveDataPool.Release(saveData);
 		}
 
 		foreach (auto _, EPF_PersistentScriptedState scriptedState : m_mScriptedStateShutdown)
@@ -412,6 +564,7 @@ class EPF_PersistenceManager
 			scriptedState.Save();
 		}
 
+		StoreLoadHotspots();
 		m_pRootEntityCollection.Save(m_pDbContext);
 
 		// Remove records about former root enties that were not purged by a persistent parent's recursive save.
@@ -474,7 +627,7 @@ class EPF_PersistenceManager
 		if (id.StartsWith("00bb"))
 			persistenceComponent.FlagAsBaked();
 
-		EPF_PersistenceComponentClass settings = EPF_ComponentData<EPF_PersistenceComponentClass>.Get(persistenceComponent);
+		EPF_PersistenceComponentClass settings = persistenceComponent.GetSettings();
 		bool isRoot = EPF_BitFlags.CheckFlags(persistenceComponent.GetFlags(), EPF_EPersistenceFlags.ROOT);
 		UpdateRootStatus(persistenceComponent, id, settings, isRoot);
 
@@ -571,6 +724,14 @@ class EPF_PersistenceManager
 		}
 	}
 
+	//------------------------------------------------------------------------------------------------
+	//! Track if a baked root entity has a record of its own, so only those are loaded on world init
+	void UpdateBakedRecord(notnull EPF_PersistenceComponent persistenceComponent, string id, bool hasRecord)
+	{
+		if (m_pRootEntityCollection && EPF_BitFlags.CheckFlags(persistenceComponent.GetFlags(), EPF_EPersistenceFlags.BAKED))
+			m_pRootEntityCollection.SetBakedRecord(id, hasRecord);
+	}
+
 	//------------------------------------------------------------------------------------------------
 	void OverrideSelfSpawn(notnull EPF_PersistenceComponent persistenceComponent, bool selfSpawn)
 	{
@@ -583,7 +744,7 @@ class EPF_PersistenceManager
 			return;
 		}
 
-		EPF_PersistenceComponentClass settings = EPF_ComponentData<EPF_PersistenceComponentClass>.Get(persistenceComponent);
+		EPF_PersistenceComponentClass settings = persistenceComponent.GetSettings();
 		m_pRootEntityCollection.ForceSelfSpawn(persistenceComponent, persistenceComponent.GetPersistentId(), settings);
 	}
 
@@ -599,7 +760,23 @@ class EPF_PersistenceManager
 	//------------------------------------------------------------------------------------------------
 	void AddOrUpdateAsync(notnull EPF_EntitySaveData saveData)
 	{
-		m_pDbContext.AddOrUpdateAsync(saveData);
+		EDF_DbOperationStatusOnlyCallback callback = EPF_SaveDataPool.TrackWrite(saveData);
+
+		// A dehydrated root only becomes dormant once its record was written
+		if (m_pDehydrating)
+		{
+			callback = new EPF_DehydrateWriteCallback(this, callback, saveData, m_pDehydrating);
+			m_pDehydrating = null;
+		}
+
+		// The world snapshot is only valid if all writes of the shutdown save succeed
+		if (m_pShutdownSnapshot)
+		{
+			m_iSnapshotPendingWrites++;
+			callback = new EPF_WorldSnapshotWriteCallback(this, callback, saveData);
+		}
+
+		m_pDbContext.AddOrUpdateAsync(saveData, callback);
 	}
 
 	//------------------------------------------------------------------------------------------------
@@ -709,6 +886,13 @@ class EPF_PersistenceManager
 	{
 		m_pSettings = settings;
 
+		// The in-memory database keeps the submitted instances, so they can never be recycled
+		EPF_SaveDataPool.SetEnabled(settings.m_bPoolSaveData && !EDF_InMemoryDbConnectionInfo.Cast(settings.m_pConnectionInfo));
+		EPF_DeferredApplyResult.SetTimeout(settings.m_iDeferredApplyTimeout);
+
+		if (settings.m_bCachePrefabCatalog)
+			EPF_PrefabCatalog.Load();
+
 		/*if (settings.m_bBufferedDatabaseContext)
 		{
 			m_pDbContext = EPF_BufferedDbContext.Create(settings.m_pConnectionInfo);
@@ -777,15 +961,26 @@ class EPF_PersistenceManager
 			m_pRootEntityCollection.SetId(GetRootEntityCollectionId());
 		}
 
+		if (m_pSettings.m_bWorldSnapshot)
+			m_pSetupSnapshot = EPF_WorldSnapshot.Load(m_pRootEntityCollection.m_iSnapshotEpoch);
+
+		// Any change from now on makes the snapshot outdated
+		m_pRootEntityCollection.m_iSnapshotEpoch = 0;
+
 		// Anything spawned after this is considered dynamic
 		SetState(EPF_EPersistenceManagerState.SETUP);
 
-		// Remove baked entities that shall no longer be root entities in the world
+		// Collect baked entities that shall no longer be root entities in the world. They are deleted over multiple frames.
+		FlushRegistrations();
+		map<int, ref array<EPF_PersistenceComponent>> removalCells();
 		array<string> staleIds();
 		foreach (string persistentId : m_pRootEntityCollection.m_aRemovedBackedRootEntities)
 		{
-			IEntity entity = FindEntityByPersistentId(persistentId);
-			if (!entity)
+			EPF_PersistenceComponent removedPersistence = m_mBakedRoots.Get(persistentId);
+			if (!removedPersistence)
+				removedPersistence = m_mUncategorizedEntities.Get(persistentId);
+
+			if (!removedPersistence || !removedPersistence.GetOwner())
 			{
 				staleIds.Insert(persistentId);
 				continue;
@@ -794,8 +989,26 @@ class EPF_PersistenceManager
 			// Add here as the entity will be removed from m_mBakedRoots during dtor, so can't find the id again later
 			m_pRootEntityCollection.m_aPossibleBackedRootEntities.Insert(persistentId);
 
-			Print(string.Format("Deleting baked entity '%1'@%2.", EPF_Utils.GetPrefabName(entity), entity.GetOrigin()), LogLevel.VERBOSE);
-			SCR_EntityHelper.DeleteEntityAndChildren(entity);
+			// Group nearby entities, so their deletions and replication updates end up in the same frames
+			vector origin = removedPersistence.GetOwner().GetOrigin();
+			int cellX = Math.Floor(origin[0] / BAKED_REMOVAL_CELL_SIZE);
+			int cellZ = Math.Floor(origin[2] / BAKED_REMOVAL_CELL_SIZE);
+			int cellKey = (cellX << 16) | (cellZ & 0xFFFF);
+			array<EPF_PersistenceComponent> cell = removalCells.Get(cellKey);
+			if (!cell)
+			{
+				cell = {};
+				removalCells.Set(cellKey, cell);
+			}
+
+			cell.Insert(removedPersistence);
+		}
+
+		m_aSetupBakedRemovals = {};
+		m_iSetupBakedRemovalIdx = 0;
+		foreach (auto _, array<EPF_PersistenceComponent> cell : removalCells)
+		{
+			m_aSetupBakedRemovals.InsertAll(cell);
 		}
 
 		// Remove any removal entries for baked objects that no longer exist
@@ -817,7 +1030,11 @@ class EPF_PersistenceManager
 			// Remember which ids were world roots on load finish so only those are removed on parent change.
 			m_pRootEntityCollection.m_aPossibleBackedRootEntities.Insert(id);
 
-			EPF_PersistenceComponentClass settings = EPF_ComponentData<EPF_PersistenceComponentClass>.Get(persistenceComponent);
+			// Most baked entities were never changed and have no record to load. Those about to be deleted do not need theirs either.
+			if (!m_pRootEntityCollection.HasBakedRecord(id) || m_pRootEntityCollection.m_aRemovedBackedRootEntities.Contains(id))
+				continue;
+
+			EPF_PersistenceComponentClass settings = persistenceComponent.GetSettings();
 			array<string> loadIds = bulkLoad.Get(settings.m_tSaveDataType);
 
 			if (!loadIds)
@@ -832,131 +1049,1298 @@ class EPF_PersistenceManager
 		// Save any mapping or root entity changes detected during world init
 		m_pRootEntityCollection.Save(m_pDbContext);
 
-		// Load all known initial entity types from db, both baked and dynamic in one bulk operation
-		m_iPendingLoadTypes = bulkLoad.Count();
+		// Loaded entities are spawned over multiple frames, so the server stays responsive on large worlds
+		m_pSetupSpawnQueue = new EPF_SetupSpawnQueue();
+		m_pSetupDeferredSpawnQueue = new EPF_SetupSpawnQueue();
+		m_bSetupLoaded = false;
+		m_iSetupLoadTotal = 0;
+		m_iSetupLoaded = 0;
+		m_mSetupPrefabHistogram = new map<ResourceName, int>();
+		m_mPrefabResources = new map<ResourceName, ref Resource>();
+		m_mSetupNavmeshRebuilds = new map<int, ref EPF_NavmeshRebuildArea>();
+		GetGame().GetCallqueue().CallLater(ProcessSetupSpawnQueue, 0, true);
+
+		// Extensions that do not need the world entities start their setup in parallel to the entity loads
+		m_aPendingExtensions = {};
+		m_aPendingExtensions.Copy(m_aExtensions);
+		StartExtensionSetups();
+
+		// Dynamic entities far away from players are only spawned once a player comes close
+		if (m_pSettings.m_fDormantEntityRadius > 0)
+		{
+			m_pDormantEntities = new EPF_DormantEntityIndex(m_pSettings.m_fDormantEntityRadius);
+			m_pDormantSpawnQueue = new EPF_DormantSpawnQueue();
+			GetGame().GetCallqueue().CallLater(UpdateDormantEntities, DORMANT_ENTITY_CHECK_INTERVAL, true);
+
+			if (m_pSettings.m_fDehydrateIdleTime > 0)
+				GetGame().GetCallqueue().CallLater(UpdateDehydration, DEHYDRATION_CHECK_INTERVAL, true);
+		}
+
+		// Entities near hotspots like spawn points are spawned first
+		if (m_pSettings.m_fPriorityLoadRadius > 0)
+		{
+			m_aLoadHotspots = {};
+			CollectLoadHotspots(m_aLoadHotspots);
+			if (m_aLoadHotspots.IsEmpty())
+				m_aLoadHotspots = null;
+		}
+
+		// Load all known initial entity types from db, both baked and dynamic, in pages of ids per type.
+		// Baked entities and those near the hotspots on the last save are requested first.
+		int pageSize = m_pSettings.m_iLoadPageSize;
+		m_aSetupLoadPages = {};
+		m_iSetupLoadPageIdx = 0;
+		m_iActiveLoads = 0;
+		array<ref EPF_PersistenceManagerLoadPage> otherPages();
 		foreach (typename saveDataType, array<string> persistentIds : bulkLoad)
 		{
-			EDF_DbFindCallbackMultipleUntyped callback(this, "OnTypeCollectionLoaded");
-			m_pDbContext.FindAllAsync(saveDataType, EDF_DbFind.Id().EqualsAnyOf(persistentIds), callback: callback);
+			m_iSetupLoadTotal += persistentIds.Count();
+
+			// Entities contained in the world snapshot need no query
+			array<string> queryIds = persistentIds;
+			if (m_pSetupSnapshot)
+				queryIds = TakeSnapshotSaveData(persistentIds);
+
+			if (!m_aLoadHotspots)
+			{
+				AddSetupLoadPages(m_aSetupLoadPages, saveDataType, queryIds, pageSize);
+				continue;
+			}
+
+			array<string> priorityIds();
+			array<string> otherIds();
+			foreach (string persistentId : queryIds)
+			{
+				if (m_mBakedRoots.Contains(persistentId) || m_pRootEntityCollection.m_aPriorityLoadEntities.Contains(persistentId))
+				{
+					priorityIds.Insert(persistentId);
+				}
+				else
+				{
+					otherIds.Insert(persistentId);
+				}
+			}
+
+			AddSetupLoadPages(m_aSetupLoadPages, saveDataType, priorityIds, pageSize);
+			AddSetupLoadPages(otherPages, saveDataType, otherIds, pageSize);
+		}
+
+		m_iSetupPriorityPageCount = m_aSetupLoadPages.Count();
+		foreach (EPF_PersistenceManagerLoadPage page : otherPages)
+		{
+			m_aSetupLoadPages.Insert(page);
 		}
+
+		if (m_pSetupSnapshot)
+		{
+			Print(string.Format("Initial world load uses snapshot with %1 entities.", m_pSetupSnapshot.Count()), LogLevel.DEBUG);
+			m_pSetupSnapshot = null;
+			PreloadPrefabs();
+		}
+
+		StartSetupLoads();
 	}
 
 	//------------------------------------------------------------------------------------------------
-	/*protected --Hotfix for 1.0 DO NOT CALL THIS MANUALLY*/
-	void OnTypeCollectionLoaded(EDF_EDbOperationStatusCode code, array<ref EDF_DbEntity> findResults)
+	//! Queue the save-data contained in the world snapshot for spawning
+	//! \return ids that are not part of the snapshot and must be loaded from the database
+	protected array<string> TakeSnapshotSaveData(notnull array<string> persistentIds)
 	{
-		foreach (EDF_DbEntity findResult : findResults)
+		array<string> remainingIds();
+		foreach (string persistentId : persistentIds)
 		{
-			EPF_EntitySaveData saveData = EPF_EntitySaveData.Cast(findResult);
-			if (!saveData)
+			EPF_EntitySaveData saveData = m_pSetupSnapshot.Take(persistentId);
+			if (saveData)
 			{
-				Debug.Error(string.Format("Unexpected database find result type '%1' encountered during entity load. Ignored.", findResult.Type().ToString()));
-				continue;
+				QueueSetupSaveData(saveData);
 			}
-
-			// Load data for baked roots
-			EPF_PersistenceComponent persistenceComponent = m_mBakedRoots.Get(saveData.GetId());
-			if (persistenceComponent)
+			else
 			{
-				persistenceComponent.Load(saveData);
-				continue;
+				remainingIds.Insert(persistentId);
 			}
-
-			// Spawn additional dynamic entites
-			SpawnWorldEntity(saveData);
 		}
 
-		if (--m_iPendingLoadTypes > 0)
+		return remainingIds;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Split the ids into pages of the load page size and add them to the pages
+	protected static void AddSetupLoadPages(notnull array<ref EPF_PersistenceManagerLoadPage> pages, typename saveDataType, notnull array<string> ids, int pageSize)
+	{
+		int idsCount = ids.Count();
+		if (idsCount == 0)
 			return;
 
-		// Free memory as it not needed after setup
-		m_mBakedRoots = null;
-		OnSetup();
-		GetGame().GetCallqueue().CallLater(TryCompleteSetup, 100, true); // Check for completion every 100ms
+		if (pageSize <= 0 || idsCount <= pageSize)
+		{
+			pages.Insert(new EPF_PersistenceManagerLoadPage(saveDataType, ids));
+			return;
+		}
+
+		for (int pageStart = 0; pageStart < idsCount; pageStart += pageSize)
+		{
+			int pageEnd = Math.Min(pageStart + pageSize, idsCount);
+			array<string> pageIds();
+			pageIds.Reserve(pageEnd - pageStart);
+			for (int idx = pageStart; idx < pageEnd; idx++)
+			{
+				pageIds.Insert(ids.Get(idx));
+			}
+
+			pages.Insert(new EPF_PersistenceManagerLoadPage(saveDataType, pageIds));
+		}
 	}
 
 	//------------------------------------------------------------------------------------------------
-	//! Add EPF_PersistenceManagerExtensionBaseComponents or extend this via modded to
-	//	add custom logic that should be awaited for with IsSetupComplete()
-	protected void OnSetup()
+	//! Request the next pages of the initial world load from the database.
+	//! Limited by the maximum concurrent requests and the amount of loaded entities still waiting to be spawned.
+	protected void StartSetupLoads()
 	{
-		foreach (EPF_PersistenceManagerExtensionBaseComponent extension : m_aExtensions)
+		int pagesCount = m_aSetupLoadPages.Count();
+		int pageSize = m_pSettings.m_iLoadPageSize;
+		int maxConcurrent = Math.Max(1, m_pSettings.m_iMaxConcurrentLoads);
+		while (m_iSetupLoadPageIdx < pagesCount && m_iActiveLoads < maxConcurrent)
 		{
-			extension.OnSetup(this);
+			// Wait for the spawn queue to catch up instead of holding all results in memory at once.
+			// Far away entities are held until all pages are loaded anyway, so only the priority queue counts.
+			if (pageSize > 0 && m_pSetupSpawnQueue.Count() >= pageSize * maxConcurrent)
+				return;
+
+			// The priority pages must all be loaded before the others, so it is known when they are done
+			if (m_iSetupLoadPageIdx == m_iSetupPriorityPageCount && m_iActiveLoads > 0)
+				return;
+
+			EPF_PersistenceManagerLoadPage page = m_aSetupLoadPages.Get(m_iSetupLoadPageIdx);
+			m_aSetupLoadPages.Set(m_iSetupLoadPageIdx++, null);
+			m_iActiveLoads++;
+
+			EDF_DbFindCallbackMultipleUntyped callback(this, "OnTypeCollectionLoaded");
+			m_pDbContext.FindAllAsync(page.m_tSaveDataType, EDF_DbFind.Id().EqualsAnyOf(page.m_aIds), callback: callback);
 		}
 	}
 
 	//------------------------------------------------------------------------------------------------
-	//! Return true if additional custom setup logic is complete. Always consider super result too!
-	protected bool IsSetupComplete()
+	//! Check if pages of baked entities or entities near the load hotspots are still being loaded
+	protected bool IsPriorityLoadPending()
 	{
-		foreach (EPF_PersistenceManagerExtensionBaseComponent extension : m_aExtensions)
+		return m_iSetupLoadPageIdx < m_iSetupPriorityPageCount ||
+			(m_iSetupLoadPageIdx == m_iSetupPriorityPageCount && m_iActiveLoads > 0);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	/*protected --Hotfix for 1.0 DO NOT CALL THIS MANUALLY*/
+	void OnTypeCollectionLoaded(EDF_EDbOperationStatusCode code, array<ref EDF_DbEntity> findResults)
+	{
+		m_iActiveLoads--;
+
+		if (findResults)
 		{
-			if (!extension.IsSetupComplete(this))
-				return false;
+			foreach (EDF_DbEntity findResult : findResults)
+			{
+				EPF_EntitySaveData saveData = EPF_EntitySaveData.Cast(findResult);
+				if (!saveData)
+				{
+					Debug.Error(string.Format("Unexpected database find result type '%1' encountered during entity load. Ignored.", findResult.Type().ToString()));
+					continue;
+				}
+
+				QueueSetupSaveData(saveData);
+			}
+
+			PreloadPrefabs();
 		}
 
-		return true;
+		StartSetupLoads();
 	}
 
 	//------------------------------------------------------------------------------------------------
-	protected void TryCompleteSetup()
+	protected void QueueSetupSaveData(notnull EPF_EntitySaveData saveData)
 	{
-		if (!IsSetupComplete())
-			return;
+		float radius = m_pSettings.m_fPriorityLoadRadius;
+		float distance = GetLoadHotspotDistance(saveData);
+		if (radius > 0 && distance > radius)
+		{
+			m_pSetupDeferredSpawnQueue.Insert(saveData);
+		}
+		else
+		{
+			// Pages arrive in id order, so the entities are spawned nearest first by distance band instead
+			int band;
+			if (radius > 0)
+				band = Math.Floor(distance / radius * PRIORITY_LOAD_BANDS);
 
-		GetGame().GetCallqueue().Remove(TryCompleteSetup);
-		OnPostSetup();
+			m_pSetupSpawnQueue.Insert(saveData, Math.ClampInt(band, 0, PRIORITY_LOAD_BANDS - 1));
+		}
+
+		saveData.CollectPrefabs(m_mSetupPrefabHistogram);
 	}
 
 	//------------------------------------------------------------------------------------------------
-	protected void OnPostSetup()
+	//! Load the resources of prefabs used more than once by the loaded save-data so far, before their entities are spawned.
+	protected void PreloadPrefabs()
 	{
-		SetState(EPF_EPersistenceManagerState.ACTIVE);
-		Print("Persistence initial world load complete.", LogLevel.DEBUG);
+		foreach (ResourceName prefab, int count : m_mSetupPrefabHistogram)
+		{
+			if (count > 1 && !m_mPrefabResources.Contains(prefab))
+				GetPrefabResource(prefab);
+		}
 	}
 
 	//------------------------------------------------------------------------------------------------
-	event void OnGameEnd()
+	//! Collect positions around which entities are loaded first during the initial world load
+	protected void CollectLoadHotspots(notnull array<vector> outHotspots)
 	{
-		Print("Persistence shutting down...", LogLevel.DEBUG);
-
-		bool wasActive = m_eState == EPF_EPersistenceManagerState.ACTIVE;
-		SetState(EPF_EPersistenceManagerState.SHUTDOWN);
-		if (wasActive)
+		foreach (EPF_SpawnPoint spawnPoint : EPF_SpawnPoint.GetSpawnPoints())
 		{
-			AutoSave(); // Trigger auto-save
-			AutoSaveTick(); // Execute auto-save instantly till end
-			ShutDownSave(); // Save those who only save on shutdown
+			outHotspots.Insert(spawnPoint.GetOrigin());
 		}
 
-		Reset();
-		Print("Persistence shut down successfully.", LogLevel.DEBUG);
+		// Players reconnecting after a restart will most likely continue where they were
+		outHotspots.InsertAll(m_pRootEntityCollection.m_aLastPlayerPositions);
 	}
 
 	//------------------------------------------------------------------------------------------------
-	protected void EPF_PersistenceManager()
+	//! Get the horizontal distance of the entity to the nearest load hotspot
+	//! \return distance or 0 if the entity has to be spawned with priority regardless of its position
+	protected float GetLoadHotspotDistance(notnull EPF_EntitySaveData saveData)
 	{
-		m_aPendingEntityRegistrations = {};
-		m_aPendingScriptedStateRegistrations = {};
-		m_mRootAutoSave = new map<string, EPF_PersistenceComponent>();
-		m_mRootAutoSaveCleanup = new map<string, typename>();
-		m_mRootShutdown = new map<string, EPF_PersistenceComponent>();
-		m_mRootShutdownCleanup = new map<string, typename>();
-		m_mUncategorizedEntities = new map<string, EPF_PersistenceComponent>();
-		m_mScriptedStateAutoSave = new map<string, EPF_PersistentScriptedState>();
-		m_mScriptedStateShutdown = new map<string, EPF_PersistentScriptedState>();
-		m_mScriptedStateUncategorized = new map<string, EPF_PersistentScriptedState>();
-		m_mBakedRoots = new map<string, EPF_PersistenceComponent>();
+		if (!m_aLoadHotspots || m_aLoadHotspots.IsEmpty())
+			return 0;
+
+		// Baked entities already exist in the world and must have their data applied before anything can save them
+		if (m_mBakedRoots.Contains(saveData.GetId()))
+			return 0;
+
+		if (!saveData.m_pTransformation || EPF_Const.IsUnset(saveData.m_pTransformation.m_vOrigin))
+			return 0;
+
+		float minDistanceSq = float.MAX;
+		foreach (vector hotspot : m_aLoadHotspots)
+		{
+			float distanceSq = vector.DistanceSqXZ(hotspot, saveData.m_pTransformation.m_vOrigin);
+			if (distanceSq < minDistanceSq)
+				minDistanceSq = distanceSq;
+		}
+
+		return Math.Sqrt(minDistanceSq);
 	}
 
 	//------------------------------------------------------------------------------------------------
-	protected static void Reset()
+	//! Spawn or load the queued initial world entities within the per frame time budget, entities near hotspots first.
+	//! Continues with the setup once all types were loaded and the queue is empty.
+	protected void ProcessSetupSpawnQueue()
 	{
-		EPF_EntitySlotPrefabInfo.Reset();
-		EPF_StorageChangeDetection.Reset();
-		EPF_PersistenceIdGenerator.Reset();
-		EPF_PersistentScriptedStateProxy.s_mProxies = null;
-		s_pInstance = null;
+		int budget = m_pSettings.m_iSetupSpawnBudget;
+		int startTime = System.GetTickCount();
+		int processed;
+
+		array<vector> playerPositions;
+		if (m_pDormantEntities)
+		{
+			playerPositions = {};
+			GetPlayerPositions(playerPositions);
+		}
+
+		// Delete removed baked entities first, so nothing is loaded into them
+		int removed = ProcessSetupBakedRemovals(budget, startTime);
+
+		// Entities further away wait for all pages, as later pages can still contain entities near the hotspots
+		bool pagesPending = m_iActiveLoads > 0 || m_iSetupLoadPageIdx < m_aSetupLoadPages.Count();
+
+		// Entities loaded this frame are updated together afterwards instead of one by one
+		EPF_WorldUtils.BeginDeferredUpdates();
+
+		while (true)
+		{
+			// Always make progress by at least one entity per frame
+			if (budget > 0 && (processed + removed) > 0 && (System.GetTickCount() - startTime) >= budget)
+				break;
+
+			EPF_EntitySaveData saveData = m_pSetupSpawnQueue.Pop();
+			if (!saveData && !pagesPending)
+				saveData = m_pSetupDeferredSpawnQueue.Pop();
+
+			if (!saveData)
+				break;
+
+			processed++;
+
+			// Load data for baked roots, skip those deleted in the meantime
+			EPF_PersistenceComponent persistenceComponent;
+			if (m_mBakedRoots.Find(saveData.GetId(), persistenceComponent))
+			{
+				// Fills the set of baked records for collections that did not track them yet
+				m_pRootEntityCollection.SetBakedRecord(saveData.GetId(), true);
+
+				if (persistenceComponent)
+					persistenceComponent.Load(saveData);
+
+				continue;
+			}
+
+			if (m_pDormantEntities && AddDormantEntity(saveData, playerPositions))
+				continue;
+
+			// Spawn additional dynamic entites
+			SpawnWorldEntity(saveData);
+		}
+
+		EPF_WorldUtils.EndDeferredUpdates();
+
+		if (processed > 0)
+		{
+			m_iSetupLoaded += processed;
+			if (m_pOnStateChangeEvent && m_eState == EPF_EPersistenceManagerState.SETUP)
+				m_pOnStateChangeEvent.Invoke(this, m_eState);
+		}
+
+		StartSetupLoads();
+
+		// Pending baked removals hold back the completion like loads, the world is only set up once they are gone
+		bool removalsPending = m_iSetupBakedRemovalIdx < m_aSetupBakedRemovals.Count();
+		bool loadsPending = removalsPending ||
+			m_iActiveLoads > 0 ||
+			m_iSetupLoadPageIdx < m_aSetupLoadPages.Count();
+
+		// With activation after the priority load only the priority pages and queue have to be done
+		bool setupLoaded;
+		if (m_pSettings.m_bActivateAfterPriorityLoad)
+		{
+			setupLoaded = !removalsPending && !IsPriorityLoadPending() && m_pSetupSpawnQueue.IsEmpty();
+		}
+		else
+		{
+			setupLoaded = !loadsPending && m_pSetupSpawnQueue.IsEmpty() && m_pSetupDeferredSpawnQueue.IsEmpty();
+		}
+
+		if (!m_bSetupLoaded && setupLoaded)
+		{
+			m_bSetupLoaded = true;
+			OnSetup();
+			TryCompleteSetup();
+
+			// Fallback for extensions that complete without notifying the manager
+			if (m_eState == EPF_EPersistenceManagerState.SETUP)
+				GetGame().GetCallqueue().CallLater(TryCompleteSetup, 100, true);
+		}
+
+		if (loadsPending || !m_pSetupSpawnQueue.IsEmpty() || !m_pSetupDeferredSpawnQueue.IsEmpty())
+			return;
+
+		GetGame().GetCallqueue().Remove(ProcessSetupSpawnQueue);
+
+		// All baked records were loaded, so from now on only those need to be queried
+		m_pRootEntityCollection.SetBakedRecordsComplete();
+
+		FlushNavmeshRebuilds();
+
+		// Free memory as it not needed after setup
+		m_pSetupSpawnQueue = null;
+		m_pSetupDeferredSpawnQueue = null;
+		m_aLoadHotspots = null;
+		m_aSetupLoadPages = null;
+		m_aSetupBakedRemovals = null;
+		m_mSetupPrefabHistogram = null;
+		m_mPrefabResources = null;
+		m_mBakedRoots = null;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Rebuild the navmesh around a loaded entity. During the initial world load the areas of all entities are merged per grid cell
+	//! and rebuilt once the loaded entities were spawned, instead of one rebuild per entity.
+	void RequestNavmeshRebuild(notnull IEntity entity)
+	{
+		SCR_AIWorld aiWorld = SCR_AIWorld.Cast(GetGame().GetAIWorld());
+		if (!aiWorld)
+			return;
+
+		if (!m_mSetupNavmeshRebuilds)
+		{
+			aiWorld.RequestNavmeshRebuildEntity(entity);
+			return;
+		}
+
+		// Same areas as a rebuild for the entity would use, covering its whole hierarchy
+		array<ref Tuple2<vector, vector>> areas();
+		array<bool> redoRoads();
+		aiWorld.GetNavmeshRebuildAreas(entity, areas, redoRoads);
+		foreach (int idx, Tuple2<vector, vector> area : areas)
+		{
+			AddNavmeshRebuildArea(area.param1, area.param2, redoRoads.Get(idx));
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Merge the area into the pending rebuild of the grid cell containing its center
+	protected void AddNavmeshRebuildArea(vector mins, vector maxs, bool redoRoads)
+	{
+		vector center = (mins + maxs) * 0.5;
+		int cellX = Math.Floor(center[0] / NAVMESH_REBUILD_CELL_SIZE);
+		int cellZ = Math.Floor(center[2] / NAVMESH_REBUILD_CELL_SIZE);
+		int cellKey = (cellX << 16) | (cellZ & 0xFFFF);
+
+		EPF_NavmeshRebuildArea area = m_mSetupNavmeshRebuilds.Get(cellKey);
+		if (!area)
+		{
+			m_mSetupNavmeshRebuilds.Set(cellKey, new EPF_NavmeshRebuildArea(mins, maxs, redoRoads));
+			return;
+		}
+
+		area.Include(mins, maxs, redoRoads);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void FlushNavmeshRebuilds()
+	{
+		if (!m_mSetupNavmeshRebuilds)
+			return;
+
+		SCR_AIWorld aiWorld = SCR_AIWorld.Cast(GetGame().GetAIWorld());
+		if (aiWorld)
+		{
+			foreach (auto _, EPF_NavmeshRebuildArea area : m_mSetupNavmeshRebuilds)
+			{
+				aiWorld.RequestNavmeshRebuild(area.m_vMins, area.m_vMaxs, area.m_bRedoRoads);
+			}
+		}
+
+		m_mSetupNavmeshRebuilds = null;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Delete the queued baked entities that are no longer part of the world within the time budget.
+	//! The navmesh areas they covered are merged per grid cell with those of the loaded entities and rebuilt once after setup.
+	//! \return number of processed removals
+	protected int ProcessSetupBakedRemovals(int budget, int startTime)
+	{
+		int removed;
+		int count = m_aSetupBakedRemovals.Count();
+		while (m_iSetupBakedRemovalIdx < count)
+		{
+			if (budget > 0 && removed > 0 && (System.GetTickCount() - startTime) >= budget)
+				break;
+
+			EPF_PersistenceComponent persistenceComponent = m_aSetupBakedRemovals.Get(m_iSetupBakedRemovalIdx++);
+			removed++;
+
+			// Could have been deleted together with a parent in the meantime
+			if (!persistenceComponent)
+				continue;
+
+			IEntity entity = persistenceComponent.GetOwner();
+			if (!entity)
+				continue;
+
+			// Areas must be collected while the hierarchy still exists
+			RequestNavmeshRebuild(entity);
+			SCR_EntityHelper.DeleteEntityAndChildren(entity);
+		}
+
+		if (removed > 0 && m_iSetupBakedRemovalIdx == count)
+			Print(string.Format("Deleted %1 baked entities that were removed from the world.", count), LogLevel.DEBUG);
+
+		return removed;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Keep the loaded dynamic entity out of the world if it is far away from all players
+	//! \return true if the entity is now dormant, false if it should be spawned
+	protected bool AddDormantEntity(notnull EPF_EntitySaveData saveData, notnull array<vector> playerPositions)
+	{
+		if (!saveData.m_pTransformation || EPF_Const.IsUnset(saveData.m_pTransformation.m_vOrigin))
+			return false;
+
+		vector origin = saveData.m_pTransformation.m_vOrigin;
+		float radiusSq = m_pSettings.m_fDormantEntityRadius * m_pSettings.m_fDormantEntityRadius;
+		foreach (vector playerPosition : playerPositions)
+		{
+			if (vector.DistanceSqXZ(playerPosition, origin) <= radiusSq)
+				return false;
+		}
+
+		EPF_DormantEntity dormantEntity();
+		dormantEntity.m_sId = saveData.GetId();
+		dormantEntity.m_tSaveDataType = saveData.Type();
+		dormantEntity.m_vOrigin = origin;
+		dormantEntity.m_pSaveData = saveData;
+		m_pDormantEntities.Insert(dormantEntity);
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Queue dormant entities players came close to for spawning
+	protected void UpdateDormantEntities()
+	{
+		if (m_pDormantEntities.Count() == 0)
+			return;
+
+		array<vector> playerPositions();
+		GetPlayerPositions(playerPositions);
+
+		array<ref EPF_DormantEntity> nearEntities();
+		foreach (vector playerPosition : playerPositions)
+		{
+			m_pDormantEntities.TakeNear(playerPosition, m_pSettings.m_fDormantEntityRadius, nearEntities);
+		}
+
+		if (nearEntities.IsEmpty())
+			return;
+
+		foreach (EPF_DormantEntity dormantEntity : nearEntities)
+		{
+			m_pDormantSpawnQueue.Insert(dormantEntity);
+		}
+
+		ScriptCallQueue callQueue = GetGame().GetCallqueue();
+		if (callQueue.GetRemainingTime(ProcessDormantSpawnQueue) == -1)
+			callQueue.CallLater(ProcessDormantSpawnQueue, 0, true);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Spawn or load the queued dormant entities within the same per frame time budget as the initial world load
+	protected void ProcessDormantSpawnQueue()
+	{
+		int budget = m_pSettings.m_iSetupSpawnBudget;
+		int startTime = System.GetTickCount();
+		int processed;
+
+		EPF_WorldUtils.BeginDeferredUpdates();
+
+		while (true)
+		{
+			// Always make progress by at least one entity per frame
+			if (budget > 0 && processed > 0 && (System.GetTickCount() - startTime) >= budget)
+				break;
+
+			EPF_DormantEntity dormantEntity = m_pDormantSpawnQueue.Pop();
+			if (!dormantEntity)
+				break;
+
+			processed++;
+
+			if (dormantEntity.m_pSaveData)
+			{
+				SpawnWorldEntity(dormantEntity.m_pSaveData);
+				continue;
+			}
+
+			EPF_PersistentWorldEntityLoader.LoadAsync(dormantEntity.m_tSaveDataType, dormantEntity.m_sId);
+		}
+
+		EPF_WorldUtils.EndDeferredUpdates();
+
+		if (m_pDormantSpawnQueue.IsEmpty())
+			GetGame().GetCallqueue().Remove(ProcessDormantSpawnQueue);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Save and remove dynamic root entities that were idle and far away from all players for the configured time.
+	//! They are spawned back from their record once a player comes close again.
+	protected void UpdateDehydration()
+	{
+		if (m_eState != EPF_EPersistenceManagerState.ACTIVE)
+			return;
+
+		array<vector> playerPositions();
+		GetPlayerPositions(playerPositions);
+
+		int now = System.GetUnixTime();
+		map<string, ref EPF_IdleRoot> idleRoots();
+		array<EPF_PersistenceComponent> dehydrateRoots();
+		CollectIdleRoots(m_mRootAutoSave, playerPositions, now, idleRoots, dehydrateRoots);
+		CollectIdleRoots(m_mRootShutdown, playerPositions, now, idleRoots, dehydrateRoots);
+		m_mIdleRoots = idleRoots;
+
+		// Removing the entities unregisters them, so this can not happen while iterating the roots
+		foreach (EPF_PersistenceComponent persistenceComponent : dehydrateRoots)
+		{
+			if (persistenceComponent)
+				Dehydrate(persistenceComponent);
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Collect roots that were far away from all players without any activity for the configured idle time
+	protected void CollectIdleRoots(
+		notnull map<string, EPF_PersistenceComponent> roots,
+		notnull array<vector> playerPositions,
+		int now,
+		notnull map<string, ref EPF_IdleRoot> outIdleRoots,
+		notnull array<EPF_PersistenceComponent> outDehydrateRoots)
+	{
+		float radiusSq = m_pSettings.m_fDormantEntityRadius * m_pSettings.m_fDormantEntityRadius;
+		int idleSeconds = m_pSettings.m_fDehydrateIdleTime * 60;
+
+		foreach (string persistentId, EPF_PersistenceComponent persistenceComponent : roots)
+		{
+			// Baked entities can not be removed without recording it as a permanent removal
+			if (!persistenceComponent ||
+				EPF_BitFlags.CheckFlags(persistenceComponent.GetFlags(), EPF_EPersistenceFlags.BAKED | EPF_EPersistenceFlags.PAUSE_TRACKING))
+			{
+				continue;
+			}
+
+			IEntity owner = persistenceComponent.GetOwner();
+			if (!owner || IsActive(owner))
+				continue;
+
+			vector origin = owner.GetOrigin();
+			bool nearPlayer;
+			foreach (vector playerPosition : playerPositions)
+			{
+				if (vector.DistanceSqXZ(playerPosition, origin) <= radiusSq)
+				{
+					nearPlayer = true;
+					break;
+				}
+			}
+
+			if (nearPlayer)
+				continue;
+
+			// Moving the entity or anything in or out of its storages restarts the idle time
+			int generation = EPF_StorageChangeDetection.GetGeneration(owner);
+			EPF_IdleRoot idleRoot;
+			if (m_mIdleRoots)
+				idleRoot = m_mIdleRoots.Get(persistentId);
+
+			if (!idleRoot ||
+				idleRoot.m_iGeneration != generation ||
+				vector.DistanceSq(idleRoot.m_vOrigin, origin) > IDLE_MOVE_DISTANCE_SQ)
+			{
+				idleRoot = new EPF_IdleRoot();
+				idleRoot.m_iIdleSince = now;
+				idleRoot.m_iGeneration = generation;
+				idleRoot.m_vOrigin = origin;
+			}
+
+			outIdleRoots.Set(persistentId, idleRoot);
+
+			if ((now - idleRoot.m_iIdleSince) >= idleSeconds)
+				outDehydrateRoots.Insert(persistenceComponent);
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Check if the entity is in use, e.g. a moving object or a vehicle with a running engine
+	protected static bool IsActive(notnull IEntity entity)
+	{
+		Physics physics = entity.GetPhysics();
+		if (physics && physics.IsDynamic() && physics.GetVelocity().LengthSq() > IDLE_VELOCITY_SQ)
+			return true;
+
+		VehicleControllerComponent vehicleController = EPF_Component<VehicleControllerComponent>.Find(entity);
+		if (vehicleController && vehicleController.IsEngineOn())
+			return true;
+
+		return false;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Save the root entity and remove it from the world. It becomes a dormant entity, that is spawned back once a player comes close,
+	//! as soon as its record was written.
+	//! \return true if the entity was removed, false if it can not be restored from its record alone
+	protected bool Dehydrate(notnull EPF_PersistenceComponent persistenceComponent)
+	{
+		IEntity owner = persistenceComponent.GetOwner();
+		string persistentId = persistenceComponent.GetPersistentId();
+		EPF_PersistenceComponentClass settings = persistenceComponent.GetSettings();
+
+		// Only entities that are spawned back from their own record, without other roots inside of them that would be lost
+		if (!m_pRootEntityCollection.IsSelfSpawn(settings.m_tSaveDataType, persistentId) ||
+			HasNestedRoot(owner) ||
+			(m_pIncrementalRead && m_pIncrementalRead.GetRoot() == persistenceComponent))
+		{
+			return false;
+		}
+
+		EPF_DormantEntity dormantEntity();
+		dormantEntity.m_sId = persistentId;
+		dormantEntity.m_tSaveDataType = settings.m_tSaveDataType;
+		dormantEntity.m_vOrigin = owner.GetOrigin();
+
+		// Picked up by AddOrUpdateAsync if the save writes the record
+		m_pDehydrating = dormantEntity;
+		EPF_EntitySaveData saveData = persistenceComponent.Save();
+		bool writeSubmitted = !m_pDehydrating;
+		m_pDehydrating = null;
+
+		if (!saveData)
+			return false;
+
+		// Anything not submitted to the database can be reused right away
+		EPF_SaveDataPool.Release(saveData);
+
+		// Record is already up to date
+		if (!writeSubmitted)
+			m_pDormantEntities.Insert(dormantEntity);
+
+		// Keep records and the root entity collection as they are while the entities are deleted
+		PauseTrackingHierarchy(owner);
+		SCR_EntityHelper.DeleteEntityAndChildren(owner);
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Called once the record of a dehydrated root entity was written
+	void OnDehydrateWriteComplete(notnull EPF_DormantEntity dormantEntity, EPF_EntitySaveData saveData, bool success)
+	{
+		if (!m_pDormantEntities || m_eState != EPF_EPersistenceManagerState.ACTIVE)
+			return;
+
+		// Restore from the save-data at hand instead of the outdated record
+		if (!success && saveData)
+		{
+			Print(string.Format("Failed to write record of dehydrated entity '%1:%2'. Its save-data is kept in memory instead.",
+				dormantEntity.m_tSaveDataType.ToString(), dormantEntity.m_sId), LogLevel.WARNING);
+
+			EPF_SaveDataPool.Share(saveData);
+			dormantEntity.m_pSaveData = saveData;
+		}
+
+		m_pDormantEntities.Insert(dormantEntity);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static bool HasNestedRoot(notnull IEntity entity)
+	{
+		IEntity child = entity.GetChildren();
+		while (child)
+		{
+			EPF_PersistenceComponent persistence = EPF_Component<EPF_PersistenceComponent>.Find(child);
+			if (persistence && EPF_BitFlags.CheckFlags(persistence.GetFlags(), EPF_EPersistenceFlags.ROOT))
+				return true;
+
+			if (HasNestedRoot(child))
+				return true;
+
+			child = child.GetSibling();
+		}
+
+		return false;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static void PauseTrackingHierarchy(notnull IEntity entity)
+	{
+		EPF_PersistenceComponent persistence = EPF_Component<EPF_PersistenceComponent>.Find(entity);
+		if (persistence)
+			persistence.PauseTracking();
+
+		IEntity child = entity.GetChildren();
+		while (child)
+		{
+			PauseTrackingHierarchy(child);
+			child = child.GetSibling();
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Write the save-data of the initial world entities saved by the shutdown save to the snapshot file.
+	//! The database is marked as matching it once all writes of the shutdown save succeeded.
+	protected void WriteWorldSnapshot()
+	{
+		// Dormant entities were not saved, but their loaded save-data still matches their record
+		if (m_pDormantEntities)
+		{
+			foreach (auto _, array<string> persistentIds : m_pRootEntityCollection.m_mSelfSpawnDynamicEntities)
+			{
+				foreach (string persistentId : persistentIds)
+				{
+					EPF_DormantEntity dormantEntity = m_pDormantEntities.Get(persistentId);
+					if (dormantEntity && dormantEntity.m_pSaveData)
+						m_pShutdownSnapshot.Add(dormantEntity.m_pSaveData);
+				}
+			}
+		}
+
+		m_pShutdownSnapshot.m_iEpoch = System.GetUnixTime();
+		if (!m_pShutdownSnapshot.Save())
+		{
+			m_pShutdownSnapshot = null;
+			return;
+		}
+
+		m_bSnapshotFileWritten = true;
+		if (m_iSnapshotPendingWrites == 0)
+			CommitWorldSnapshot();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Keep the save-data written for an initial world entity by the shutdown save for the snapshot
+	protected void AddWorldSnapshotEntity(notnull EPF_PersistenceComponent persistenceComponent, EPF_EntitySaveData saveData)
+	{
+		if (!saveData)
+			return;
+
+		// Only entities loaded on the next start are part of the snapshot, anything else is looked up from the database
+		string persistentId = persistenceComponent.GetPersistentId();
+		EPF_PersistenceComponentClass settings = persistenceComponent.GetSettings();
+		if (!m_pRootEntityCollection.IsSelfSpawn(settings.m_tSaveDataType, persistentId) &&
+			!m_pRootEntityCollection.m_aStoredBakedRootEntities.Contains(persistentId))
+		{
+			return;
+		}
+
+		// Kept beyond the save operation, so the pool must not recycle it once written
+		EPF_SaveDataPool.Share(saveData);
+		m_pShutdownSnapshot.Add(saveData);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Called for each database write of the shutdown save while a world snapshot is collected
+	void OnWorldSnapshotWriteComplete(bool success)
+	{
+		m_iSnapshotPendingWrites--;
+		if (!success)
+			m_bSnapshotWriteFailed = true;
+
+		if (m_iSnapshotPendingWrites == 0 && m_bSnapshotFileWritten)
+			CommitWorldSnapshot();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void CommitWorldSnapshot()
+	{
+		EPF_WorldSnapshot snapshot = m_pShutdownSnapshot;
+		m_pShutdownSnapshot = null;
+		m_bSnapshotFileWritten = false;
+		if (!snapshot)
+			return;
+
+		if (m_bSnapshotWriteFailed)
+		{
+			Print("Persistence world snapshot is not used, because not all entities could be saved to the database.", LogLevel.WARNING);
+			return;
+		}
+
+		m_pRootEntityCollection.m_iSnapshotEpoch = snapshot.m_iEpoch;
+		m_pRootEntityCollection.Save(m_pDbContext);
+		Print(string.Format("Persistence world snapshot with %1 entities written.", snapshot.Count()), LogLevel.DEBUG);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Remember where the players are and which entities are near the load hotspots, so those are loaded first on the next world load
+	protected void StoreLoadHotspots()
+	{
+		array<vector> playerPositions();
+		GetPlayerPositions(playerPositions);
+
+		// Keep the previous positions while nobody is connected, e.g. on a shutdown after all players left
+		if (!playerPositions.IsEmpty())
+			m_pRootEntityCollection.m_aLastPlayerPositions = playerPositions;
+
+		float radius = m_pSettings.m_fPriorityLoadRadius;
+		if (radius <= 0)
+			return;
+
+		array<vector> hotspots();
+		CollectLoadHotspots(hotspots);
+
+		float radiusSq = radius * radius;
+		set<string> priorityIds();
+		foreach (auto _, array<string> persistentIds : m_pRootEntityCollection.m_mSelfSpawnDynamicEntities)
+		{
+			foreach (string persistentId : persistentIds)
+			{
+				IEntity entity = FindEntityByPersistentId(persistentId);
+				if (!entity)
+					continue;
+
+				vector origin = entity.GetOrigin();
+				foreach (vector hotspot : hotspots)
+				{
+					if (vector.DistanceSqXZ(hotspot, origin) <= radiusSq)
+					{
+						priorityIds.Insert(persistentId);
+						break;
+					}
+				}
+			}
+		}
+
+		m_pRootEntityCollection.m_aPriorityLoadEntities = priorityIds;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the positions of all player controlled entities
+	protected void GetPlayerPositions(notnull array<vector> outPositions)
+	{
+		PlayerManager playerManager = GetGame().GetPlayerManager();
+		array<int> playerIds();
+		playerManager.GetPlayers(playerIds);
+		foreach (int playerId : playerIds)
+		{
+			IEntity controlledEntity = playerManager.GetPlayerControlledEntity(playerId);
+			if (controlledEntity)
+				outPositions.Insert(controlledEntity.GetOrigin());
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Add EPF_PersistenceManagerExtensionBaseComponents or extend this via modded to
+	//	add custom logic that should be awaited for with IsSetupComplete(). Called once all initial world entities were loaded.
+	protected void OnSetup()
+	{
+		StartExtensionSetups();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Start the setup of all pending extensions whose requirements are met.
+	//! Repeats until no further extension can be started, as extensions may complete their setup right away.
+	protected void StartExtensionSetups()
+	{
+		if (!m_aPendingExtensions || m_bStartingExtensions)
+			return;
+
+		m_bStartingExtensions = true;
+
+		bool started = true;
+		while (started)
+		{
+			started = false;
+			for (int idx = 0; idx < m_aPendingExtensions.Count(); idx++)
+			{
+				EPF_PersistenceManagerExtensionBaseComponent extension = m_aPendingExtensions.Get(idx);
+				if (extension && ((extension.IsWorldLoadRequired() && !m_bSetupLoaded) || !AreSetupDependenciesComplete(extension)))
+					continue;
+
+				m_aPendingExtensions.RemoveOrdered(idx);
+				idx--;
+
+				if (extension)
+				{
+					extension.OnSetup(this);
+					started = true;
+				}
+			}
+		}
+
+		m_bStartingExtensions = false;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected bool AreSetupDependenciesComplete(notnull EPF_PersistenceManagerExtensionBaseComponent extension)
+	{
+		array<typename> dependencies = extension.GetSetupDependencies();
+		if (!dependencies)
+			return true;
+
+		foreach (typename dependency : dependencies)
+		{
+			foreach (EPF_PersistenceManagerExtensionBaseComponent other : m_aExtensions)
+			{
+				if (other && other != extension && other.IsInherited(dependency) && !other.IsSetupComplete(this))
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Notify the manager that an extension finished its setup, see EPF_PersistenceManagerExtensionBaseComponent.SetSetupComplete()
+	void OnExtensionSetupComplete(notnull EPF_PersistenceManagerExtensionBaseComponent extension)
+	{
+		// Picked up by the running start loop
+		if (m_bStartingExtensions || m_eState != EPF_EPersistenceManagerState.SETUP)
+			return;
+
+		StartExtensionSetups();
+		TryCompleteSetup();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Return true if additional custom setup logic is complete. Always consider super result too!
+	protected bool IsSetupComplete()
+	{
+		if (m_aPendingExtensions && !m_aPendingExtensions.IsEmpty())
+			return false;
+
+		foreach (EPF_PersistenceManagerExtensionBaseComponent extension : m_aExtensions)
+		{
+			if (extension && !extension.IsSetupComplete(this))
+				return false;
+		}
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void TryCompleteSetup()
+	{
+		if (m_eState != EPF_EPersistenceManagerState.SETUP || !m_bSetupLoaded)
+			return;
+
+		// Extensions that complete without notifying the manager might unblock others
+		StartExtensionSetups();
+		if (!IsSetupComplete())
+			return;
+
+		GetGame().GetCallqueue().Remove(TryCompleteSetup);
+		OnPostSetup();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void OnPostSetup()
+	{
+		SetState(EPF_EPersistenceManagerState.ACTIVE);
+		Print("Persistence initial world load complete.", LogLevel.DEBUG);
+
+		if (m_pSettings.m_bCachePrefabCatalog)
+			EPF_PrefabCatalog.Save();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	event void OnGameEnd()
+	{
+		Print("Persistence shutting down...", LogLevel.DEBUG);
+
+		// Stop spawning entities that are still loading after an early activation
+		GetGame().GetCallqueue().Remove(ProcessSetupSpawnQueue);
+		GetGame().GetCallqueue().Remove(UpdateDormantEntities);
+		GetGame().GetCallqueue().Remove(ProcessDormantSpawnQueue);
+		GetGame().GetCallqueue().Remove(UpdateDehydration);
+
+		bool wasActive = m_eState == EPF_EPersistenceManagerState.ACTIVE;
+		SetState(EPF_EPersistenceManagerState.SHUTDOWN);
+		if (wasActive)
+		{
+			// Collects the save-data written by the shutdown save
+			if (m_pSettings.m_bWorldSnapshot)
+				m_pShutdownSnapshot = new EPF_WorldSnapshot();
+
+			AutoSave(); // Trigger auto-save
+			AutoSaveTick(); // Execute auto-save instantly till end
+			ShutDownSave(); // Save those who only save on shutdown
+
+			if (m_pShutdownSnapshot)
+				WriteWorldSnapshot();
+		}
+
+		if (m_pSettings && m_pSettings.m_bCachePrefabCatalog)
+			EPF_PrefabCatalog.Save();
+
+		Reset();
+		Print("Persistence shut down successfully.", LogLevel.DEBUG);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected void EPF_PersistenceManager()
+	{
+		m_aPendingEntityRegistrations = {};
+		m_aPendingScriptedStateRegistrations = {};
+		m_mRootAutoSave = new map<string, EPF_PersistenceComponent>();
+		m_mRootAutoSaveCleanup = new map<string, typename>();
+		m_mRootShutdown = new map<string, EPF_PersistenceComponent>();
+		m_mRootShutdownCleanup = new map<string, typename>();
+		m_mUncategorizedEntities = new map<string, EPF_PersistenceComponent>();
+		m_mScriptedStateAutoSave = new map<string, EPF_PersistentScriptedState>();
+		m_mScriptedStateShutdown = new map<string, EPF_PersistentScriptedState>();
+		m_mScriptedStateUncategorized = new map<string, EPF_PersistentScriptedState>();
+		m_mBakedRoots = new map<string, EPF_PersistenceComponent>();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static void Reset()
+	{
+		EPF_PrefabCatalog.Reset();
+		EPF_StorageChangeDetection.Reset();
+		EPF_PersistenceIdGenerator.Reset();
+		EPF_SaveDataPool.Reset();
+		EPF_PersistentScriptedStateProxy.s_mProxies = null;
+		s_pInstance = null;
+	}
+}
+
+class EPF_PersistenceManagerLoadPage
+{
+	typename m_tSaveDataType;
+	ref array<string> m_aIds;
+
+	//------------------------------------------------------------------------------------------------
+	void EPF_PersistenceManagerLoadPage(typename saveDataType, array<string> ids)
+	{
+		m_tSaveDataType = saveDataType;
+		m_aIds = ids;
+	}
+}
+
+//! Save-data awaiting its spawn. Entries of lower bands are taken first, entries of the same band in insertion order.
+class EPF_SetupSpawnQueue
+{
+	protected ref array<ref array<ref EPF_EntitySaveData>> m_aBands = {};
+	protected ref array<int> m_aNextIdx = {};
+	protected int m_iFirstBand;
+	protected int m_iCount;
+
+	//------------------------------------------------------------------------------------------------
+	void Insert(notnull EPF_EntitySaveData saveData, int band = 0)
+	{
+		while (m_aBands.Count() <= band)
+		{
+			m_aBands.Insert(new array<ref EPF_EntitySaveData>());
+			m_aNextIdx.Insert(0);
+		}
+
+		m_aBands.Get(band).Insert(saveData);
+		m_iCount++;
+
+		if (band < m_iFirstBand)
+			m_iFirstBand = band;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Take the next save-data out of the queue
+	//! \return save-data or null if the queue is empty
+	EPF_EntitySaveData Pop()
+	{
+		if (m_iCount == 0)
+			return null;
+
+		int bandCount = m_aBands.Count();
+		for (int band = m_iFirstBand; band < bandCount; band++)
+		{
+			array<ref EPF_EntitySaveData> entries = m_aBands.Get(band);
+			int nextIdx = m_aNextIdx.Get(band);
+			if (nextIdx >= entries.Count())
+				continue;
+
+			m_iFirstBand = band;
+
+			EPF_EntitySaveData saveData = entries.Get(nextIdx);
+			entries.Set(nextIdx++, null); // Free the save-data once processed
+
+			if (nextIdx >= entries.Count())
+			{
+				entries.Clear();
+				nextIdx = 0;
+			}
+
+			m_aNextIdx.Set(band, nextIdx);
+			m_iCount--;
+			return saveData;
+		}
+
+		return null;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	int Count()
+	{
+		return m_iCount;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	bool IsEmpty()
+	{
+		return m_iCount == 0;
+	}
+}
+
+class EPF_NavmeshRebuildArea
+{
+	vector m_vMins;
+	vector m_vMaxs;
+	bool m_bRedoRoads;
+
+	//------------------------------------------------------------------------------------------------
+	//! Grow the area to also contain the bounds. Roads are redone if any of the merged areas requires it.
+	void Include(vector mins, vector maxs, bool redoRoads)
+	{
+		m_vMins = Vector(Math.Min(m_vMins[0], mins[0]), Math.Min(m_vMins[1], mins[1]), Math.Min(m_vMins[2], mins[2]));
+		m_vMaxs = Vector(Math.Max(m_vMaxs[0], maxs[0]), Math.Max(m_vMaxs[1], maxs[1]), Math.Max(m_vMaxs[2], maxs[2]));
+		m_bRedoRoads |= redoRoads;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void EPF_NavmeshRebuildArea(vector mins, vector maxs, bool redoRoads)
+	{
+		m_vMins = mins;
+		m_vMaxs = maxs;
+		m_bRedoRoads = redoRoads;
+	}
+}
+
+class EPF_WorldSnapshotWriteCallback : EDF_DbOperationStatusOnlyCallback
+{
+	// Kept alive until the database is done, even if the manager was reset after the shutdown
+	protected ref EPF_PersistenceManager m_pPersistenceManager;
+	protected ref EDF_DbOperationStatusOnlyCallback m_pPoolCallback;
+	protected EPF_EntitySaveData m_pSaveData;
+
+	//------------------------------------------------------------------------------------------------
+	override void OnSuccess(Managed context)
+	{
+		if (m_pPoolCallback)
+			m_pPoolCallback.OnSuccess(m_pSaveData);
+
+		m_pPersistenceManager.OnWorldSnapshotWriteComplete(true);
+		m_pPersistenceManager = null;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override void OnFailure(EDF_EDbOperationStatusCode statusCode, Managed context)
+	{
+		if (m_pPoolCallback)
+			m_pPoolCallback.OnFailure(statusCode, m_pSaveData);
+
+		m_pPersistenceManager.OnWorldSnapshotWriteComplete(false);
+		m_pPersistenceManager = null;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! \param poolCallback callback of EPF_SaveDataPool.TrackWrite() to forward the result to, if any
+	void EPF_WorldSnapshotWriteCallback(notnull EPF_PersistenceManager persistenceManager, EDF_DbOperationStatusOnlyCallback poolCallback, EPF_EntitySaveData saveData)
+	{
+		m_pPersistenceManager = persistenceManager;
+		m_pPoolCallback = poolCallback;
+		m_pSaveData = saveData;
+	}
+}
+
+class EPF_IdleRoot
+{
+	int m_iIdleSince;
+	int m_iGeneration;
+	vector m_vOrigin;
+}
+
+class EPF_DehydrateWriteCallback : EDF_DbOperationStatusOnlyCallback
+{
+	protected EPF_PersistenceManager m_pPersistenceManager;
+	protected ref EDF_DbOperationStatusOnlyCallback m_pPoolCallback;
+	protected ref EPF_EntitySaveData m_pSaveData;
+	protected ref EPF_DormantEntity m_pDormantEntity;
+
+	//------------------------------------------------------------------------------------------------
+	override void OnSuccess(Managed context)
+	{
+		if (m_pPersistenceManager)
+			m_pPersistenceManager.OnDehydrateWriteComplete(m_pDormantEntity, m_pSaveData, true);
+
+		if (m_pPoolCallback)
+			m_pPoolCallback.OnSuccess(m_pSaveData);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override void OnFailure(EDF_EDbOperationStatusCode statusCode, Managed context)
+	{
+		// Notify first, so the save-data is kept before the pool can recycle it
+		if (m_pPersistenceManager)
+			m_pPersistenceManager.OnDehydrateWriteComplete(m_pDormantEntity, m_pSaveData, false);
+
+		if (m_pPoolCallback)
+			m_pPoolCallback.OnFailure(statusCode, m_pSaveData);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! \param poolCallback callback of EPF_SaveDataPool.TrackWrite() to forward the result to, if any
+	void EPF_DehydrateWriteCallback(notnull EPF_PersistenceManager persistenceManager, EDF_DbOperationStatusOnlyCallback poolCallback, EPF_EntitySaveData saveData, EPF_DormantEntity dormantEntity)
+	{
+		m_pPersistenceManager = persistenceManager;
+		m_pPoolCallback = poolCallback;
+		m_pSaveData = saveData;
+		m_pDormantEntity = dormantEntity;
 	}
 }
@@ -10,9 +10,45 @@ class EPF_PersistenceManagerComponentClass : SCR_BaseGameModeComponentClass
 	[Attribute(defvalue: "5", uiwidget: UIWidgets.Slider, desc: "Maximum number of entities processed during a single update tick.", params: "1 128 1", category: "Auto-Save")]
 	int m_iAutosaveIterations;
 
+	[Attribute(defvalue: "250", uiwidget: UIWidgets.Slider, desc: "Maximum number of nested entities (e.g. items inside a storage) read during a single update tick.\nEntities with larger hierarchies are read over multiple ticks before the entity itself is saved. 0 = disabled", params: "0 5000 1", category: "Auto-Save")]
+	int m_iMaxNestedReadsPerTick;
+
+	[Attribute(defvalue: "1000", uiwidget: UIWidgets.Slider, desc: "Maximum number of entities requested from the database at once during the initial world load.\n0 = request all entities of a type at once", params: "0 10000 100", category: "Advanced")]
+	int m_iLoadPageSize;
+
+	[Attribute(defvalue: "4", uiwidget: UIWidgets.Slider, desc: "Maximum number of database requests in flight during the initial world load.", params: "1 32 1", category: "Advanced")]
+	int m_iMaxConcurrentLoads;
+
+	[Attribute(defvalue: "8", uiwidget: UIWidgets.Slider, desc: "Time in milliseconds per frame that is spent on spawning and loading entities during the initial world load.\n0 = unlimited, everything is spawned as soon as it was loaded from the database", params: "0 100 1", category: "Advanced")]
+	int m_iSetupSpawnBudget;
+
+	[Attribute(defvalue: "0", uiwidget: UIWidgets.Slider, desc: "Entities within this distance in meters of a spawn point are spawned before all others during the initial world load.\n0 = disabled", params: "0 5000 10", category: "Advanced")]
+	float m_fPriorityLoadRadius;
+
+	[Attribute(defvalue: "0", desc: "Complete the initial world load once the entities near spawn points are loaded. Entities further away are spawned afterwards.", category: "Advanced")]
+	bool m_bActivateAfterPriorityLoad;
+
+	[Attribute(defvalue: "0", uiwidget: UIWidgets.Slider, desc: "Dynamic self spawn entities further away than this distance in meters from every player are kept out of the world until a player comes close.\n0 = disabled, all entities are spawned on load", params: "0 5000 10", category: "Advanced")]
+	float m_fDormantEntityRadius;
+
+	[Attribute(defvalue: "0", uiwidget: UIWidgets.Slider, desc: "Minutes a dynamic self spawn root entity has to be idle and further away than the dormant entity radius from every player, before it is saved and removed until a player comes close again.\nIdle means not moving, no running engine and no inventory changes.\n0 = disabled. Requires a dormant entity radius.", params: "0 240 1", category: "Advanced")]
+	float m_fDehydrateIdleTime;
+
+	[Attribute(defvalue: "10000", uiwidget: UIWidgets.Slider, desc: "Time in milliseconds after which loading an entity counts as complete, even if some components are still awaiting e.g. animations. Stalled components are reported as warning.\n0 = wait forever", params: "0 60000 1000", category: "Advanced")]
+	int m_iDeferredApplyTimeout;
+
 	[Attribute(defvalue: "0.33", uiwidget: UIWidgets.Slider, desc: "Adjust the tick rate of the persistence manager", params: "0.01 10 0.01", category: "Advanced", precision: 2)]
 	float m_fUpdateRate;
 
+	[Attribute(defvalue: "0", desc: "Reuse save-data instances across save cycles to reduce allocations on large worlds.\nSave-data passed to save events must not be kept beyond the save operation when enabled. Has no effect for the in-memory database.", category: "Advanced")]
+	bool m_bPoolSaveData;
+
+	[Attribute(defvalue: "0", desc: "Keep resolved prefab information in a server local cache file so restarts skip inspecting the prefab resources.\nThe cache is rebuilt when the game version or the loaded addons change.", category: "Advanced")]
+	bool m_bCachePrefabCatalog;
+
+	[Attribute(defvalue: "0", desc: "Write the save-data of all initial world entities into a single server local file on shutdown.\nThe next start loads from it instead of querying the database, if the database was not changed in between.", category: "Advanced")]
+	bool m_bWorldSnapshot;
+
 	[Attribute(desc: "Default database connection. Can be overriden using \"-ConnectionString=...\" CLI argument", category: "Database")]
 	ref EDF_DbConnectionInfoBase m_pConnectionInfo;
 
@@ -5,9 +5,44 @@ class EPF_PersistenceManagerExtensionBaseComponentClass : ScriptComponentClass
 
 class EPF_PersistenceManagerExtensionBaseComponent : ScriptComponent
 {
+	protected bool m_bSetupComplete;
+
 	//------------------------------------------------------------------------------------------------
+	//! Called once the requirements of the extension are met, see IsWorldLoadRequired() and GetSetupDependencies()
 	void OnSetup(EPF_PersistenceManager persistenceManager);
-	
+
+	//------------------------------------------------------------------------------------------------
+	//! Return true once the setup is done. Prefer calling SetSetupComplete() over overriding this, so the manager does not need to poll.
+	bool IsSetupComplete(EPF_PersistenceManager persistenceManager)
+	{
+		return m_bSetupComplete;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Return false if the setup does not need the initial world entities, so it can run in parallel to their load.
+	bool IsWorldLoadRequired()
+	{
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Extension types that have to complete their setup before this one is started. Must not form cycles.
+	array<typename> GetSetupDependencies()
+	{
+		return null;
+	}
+
 	//------------------------------------------------------------------------------------------------
-	bool IsSetupComplete(EPF_PersistenceManager persistenceManager);
+	//! Mark the setup as done and notify the persistence manager
+	protected void SetSetupComplete()
+	{
+		if (m_bSetupComplete)
+			return;
+
+		m_bSetupComplete = true;
+
+		EPF_PersistenceManager persistenceManager = EPF_PersistenceManager.GetInstance(false);
+		if (persistenceManager)
+			persistenceManager.OnExtensionSetupComplete(this);
+	}
 }
@@ -7,9 +7,24 @@ class EPF_PersistentRootEntityCollection : EPF_MetaDataDbEntity
 	ref set<string> m_aRemovedBackedRootEntities = new set<string>();
 	ref map<typename, ref array<string>> m_mSelfSpawnDynamicEntities = new map<typename, ref array<string>>();
 
+	// Baked root entities that have a record of their own. Only those need to be loaded on world init.
+	ref set<string> m_aStoredBakedRootEntities = new set<string>();
+
+	// Epoch of the world snapshot written on the last shutdown, 0 once anything could have changed since
+	int m_iSnapshotEpoch;
+
+	// Positions of the player controlled entities on the last save, loaded first on world init
+	ref array<vector> m_aLastPlayerPositions = {};
+
+	// Self spawn root entities near a load hotspot on the last save, their pages are loaded first on world init
+	ref set<string> m_aPriorityLoadEntities = new set<string>();
+
 	[NonSerialized()]
 	protected bool m_bHasData;
 
+	[NonSerialized()]
+	protected bool m_bStoredBakedRootEntitiesComplete;
+
 	//------------------------------------------------------------------------------------------------
 	void Add(EPF_PersistenceComponent persistenceComponent, string persistentId, EPF_EPersistenceManagerState state)
 	{
@@ -19,7 +34,7 @@ class EPF_PersistentRootEntityCollection : EPF_MetaDataDbEntity
 				return;
 		}
 
-		EPF_PersistenceComponentClass settings = EPF_ComponentData<EPF_PersistenceComponentClass>.Get(persistenceComponent);
+		EPF_PersistenceComponentClass settings = persistenceComponent.GetSettings();
 		if (!settings.m_bSelfSpawn)
 			return;
 
@@ -41,6 +56,14 @@ class EPF_PersistentRootEntityCollection : EPF_MetaDataDbEntity
 			ids.Insert(persistentId);
 	}
 
+	//------------------------------------------------------------------------------------------------
+	//! Check if the entity is spawned back from its record when the world is loaded
+	bool IsSelfSpawn(typename saveDataType, string persistentId)
+	{
+		array<string> ids = m_mSelfSpawnDynamicEntities.Get(saveDataType);
+		return ids && ids.Contains(persistentId);
+	}
+
 	//------------------------------------------------------------------------------------------------
 	void Remove(EPF_PersistenceComponent persistenceComponent, string persistentId, EPF_EPersistenceManagerState state)
 	{
@@ -51,7 +74,7 @@ class EPF_PersistentRootEntityCollection : EPF_MetaDataDbEntity
 			return;
 		}
 
-		EPF_PersistenceComponentClass settings = EPF_ComponentData<EPF_PersistenceComponentClass>.Get(persistenceComponent);
+		EPF_PersistenceComponentClass settings = persistenceComponent.GetSettings();
 		array<string> ids = m_mSelfSpawnDynamicEntities.Get(settings.m_tSaveDataType);
 		if (!ids)
 			return;
@@ -62,12 +85,42 @@ class EPF_PersistentRootEntityCollection : EPF_MetaDataDbEntity
 			m_mSelfSpawnDynamicEntities.Remove(settings.m_tSaveDataType);
 	}
 
+	//------------------------------------------------------------------------------------------------
+	//! Remember if a baked root entity has a record of its own
+	void SetBakedRecord(string persistentId, bool hasRecord)
+	{
+		if (hasRecord)
+		{
+			m_aStoredBakedRootEntities.Insert(persistentId);
+		}
+		else
+		{
+			m_aStoredBakedRootEntities.RemoveItem(persistentId);
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Check if the baked root entity has to be loaded on world init
+	bool HasBakedRecord(string persistentId)
+	{
+		// Collections stored before the manifest was introduced do not know about existing records
+		return !m_bStoredBakedRootEntitiesComplete || m_aStoredBakedRootEntities.Contains(persistentId);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Flag the stored baked root entities as complete, after all baked records were loaded once
+	void SetBakedRecordsComplete()
+	{
+		m_bStoredBakedRootEntitiesComplete = true;
+	}
+
 	//------------------------------------------------------------------------------------------------
 	void Save(EDF_DbContext dbContext)
 	{
 		m_iLastSaved = System.GetUnixTime();
 
-		bool hasData = !m_aRemovedBackedRootEntities.IsEmpty() || !m_mSelfSpawnDynamicEntities.IsEmpty();
+		// Keep the record once it tracks the baked records, so an empty set is not mistaken for an unknown one
+		bool hasData = !m_aRemovedBackedRootEntities.IsEmpty() || !m_mSelfSpawnDynamicEntities.IsEmpty() || m_bStoredBakedRootEntitiesComplete;
 		if (hasData)
 		{
 			dbContext.AddOrUpdateAsync(this);
@@ -88,6 +141,9 @@ class EPF_PersistentRootEntityCollection : EPF_MetaDataDbEntity
 		if (!saveContext.IsValid())
 			return false;
 
+		if (m_bStoredBakedRootEntitiesComplete)
+			m_iDataLayoutVersion = 5;
+
 		SerializeMetaData(saveContext);
 
 		saveContext.WriteValue("m_aRemovedBackedRootEntities", m_aRemovedBackedRootEntities);
@@ -105,6 +161,14 @@ class EPF_PersistentRootEntityCollection : EPF_MetaDataDbEntity
 
 		saveContext.WriteValue("m_aSelfSpawnDynamicEntities", selfSpawnDynamicEntities);
 
+		if (m_bStoredBakedRootEntitiesComplete)
+		{
+			saveContext.WriteValue("m_aStoredBakedRootEntities", m_aStoredBakedRootEntities);
+			saveContext.WriteValue("m_iSnapshotEpoch", m_iSnapshotEpoch);
+			saveContext.WriteValue("m_aLastPlayerPositions", m_aLastPlayerPositions);
+			saveContext.WriteValue("m_aPriorityLoadEntities", m_aPriorityLoadEntities);
+		}
+
 		return true;
 	}
 
@@ -126,7 +190,22 @@ class EPF_PersistentRootEntityCollection : EPF_MetaDataDbEntity
 			m_mSelfSpawnDynamicEntities.Set(EDF_DbName.GetTypeByName(entry.m_sSaveDataType), entry.m_aIds);
 		}
 
-		m_bHasData = !m_aRemovedBackedRootEntities.IsEmpty() || !m_mSelfSpawnDynamicEntities.IsEmpty();
+		if (m_iDataLayoutVersion >= 2)
+		{
+			loadContext.ReadValue("m_aStoredBakedRootEntities", m_aStoredBakedRootEntities);
+			m_bStoredBakedRootEntitiesComplete = true;
+		}
+
+		if (m_iDataLayoutVersion >= 3)
+			loadContext.ReadValue("m_iSnapshotEpoch", m_iSnapshotEpoch);
+
+		if (m_iDataLayoutVersion >= 4)
+			loadContext.ReadValue("m_aLastPlayerPositions", m_aLastPlayerPositions);
+
+		if (m_iDataLayoutVersion >= 5)
+			loadContext.ReadValue("m_aPriorityLoadEntities", m_aPriorityLoadEntities);
+
+		m_bHasData = !m_aRemovedBackedRootEntities.IsEmpty() || !m_mSelfSpawnDynamicEntities.IsEmpty() || m_bStoredBakedRootEntitiesComplete;
 
 		return true;
 	}
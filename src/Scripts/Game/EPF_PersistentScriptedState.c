@@ -119,6 +119,9 @@ class EPF_PersistentScriptedState
 			m_iLastSaved = saveData.m_iLastSaved;
 		}
 
+		// Restore information that this state has its own record in db so default trimming or delete can remove it.
+		EPF_BitFlags.SetFlags(m_eFlags, EPF_EPersistenceFlags.PERSISTENT_RECORD);
+
 		if (!saveData.ApplyTo(target))
 		{
 			Debug.Error(string.Format("Failed to apply save-data '%1:%2' to entity.", saveData.Type().ToString(), saveData.GetId()));
@@ -168,13 +171,16 @@ class EPF_PersistentScriptedState
 
 		EPF_PersistentScriptedStateSettings settings = EPF_PersistentScriptedStateSettings.Get(target.Type());
 		EPF_ScriptedStateSaveData saveData = EPF_ScriptedStateSaveData.Cast(settings.m_tSaveDataType.Spawn());
-		if (!saveData || !saveData.ReadFrom(target))
+
+		EPF_EReadResult readResult;
+		if (saveData)
+			readResult = saveData.ReadFrom(target);
+
+		if (!readResult)
 		{
 			Debug.Error(string.Format("Failed to persist scripted state '%1'. Save-data could not be read.", target));
 			return null;
 		}
-		
-		// TODO: Missing support for scripted state default skip?
 
 		if (proxy)
 		{
@@ -185,17 +191,35 @@ class EPF_PersistentScriptedState
 		if (m_pOnAfterSave)
 			m_pOnAfterSave.Invoke(this, saveData);
 
-		EPF_ScriptedStateSaveData lastData;
-		if (EPF_BitFlags.CheckFlags(settings.m_eOptions, EPF_EPersistentScriptedStateOptions.USE_CHANGE_TRACKER))
-			lastData = m_mLastSaveData.Get(this);
+		bool isPersistent = EPF_BitFlags.CheckFlags(m_eFlags, EPF_EPersistenceFlags.PERSISTENT_RECORD);
+		bool useChangeTracker = EPF_BitFlags.CheckFlags(settings.m_eOptions, EPF_EPersistentScriptedStateOptions.USE_CHANGE_TRACKER);
 
-		if (!lastData || !lastData.Equals(saveData))
-			EPF_PersistenceManager.GetInstance().GetDbContext().AddOrUpdateAsync(saveData);
+		if (readResult == EPF_EReadResult.DEFAULT)
+		{
+			// Nothing worth a record. Remove any previous one so the next load falls back to the default state again.
+			if (isPersistent)
+			{
+				EPF_PersistenceManager.GetInstance().RemoveAsync(settings.m_tSaveDataType, m_sId);
+				EPF_BitFlags.ClearFlags(m_eFlags, EPF_EPersistenceFlags.PERSISTENT_RECORD);
+			}
+		}
+		else
+		{
+			EPF_ScriptedStateSaveData lastData;
+			if (useChangeTracker)
+				lastData = m_mLastSaveData.Get(this);
 
-		if (EPF_BitFlags.CheckFlags(settings.m_eOptions, EPF_EPersistentScriptedStateOptions.USE_CHANGE_TRACKER))
+			if (!isPersistent || !lastData || !lastData.Equals(saveData))
+			{
+				EPF_PersistenceManager.GetInstance().GetDbContext().AddOrUpdateAsync(saveData);
+				EPF_BitFlags.SetFlags(m_eFlags, EPF_EPersistenceFlags.PERSISTENT_RECORD);
+			}
+		}
+
+		if (useChangeTracker)
 			m_mLastSaveData.Set(this, saveData);
 
-		if (m_pOnAfterPersist)
+		if (m_pOnAfterPersist && readResult != EPF_EReadResult.DEFAULT)
 			m_pOnAfterPersist.Invoke(this, saveData);
 
 		return saveData;
@@ -205,9 +229,11 @@ class EPF_PersistentScriptedState
 	//! Delete the persistence data of this scripted state. Does not delete the state instance itself.
 	void Delete()
 	{
-		// Only attempt to remove it if it was ever saved
-		if (m_sId && m_iLastSaved > 0)
+		// Only attempt to remove it if there is a record for it
+		if (m_sId && EPF_BitFlags.CheckFlags(m_eFlags, EPF_EPersistenceFlags.PERSISTENT_RECORD))
 		{
+			EPF_BitFlags.ClearFlags(m_eFlags, EPF_EPersistenceFlags.PERSISTENT_RECORD);
+
 			Managed target;
 			EPF_PersistentScriptedStateProxy proxy = EPF_PersistentScriptedStateProxy.Cast(this);
 			if (proxy)
@@ -397,6 +423,9 @@ class EPF_PersistentScriptedStateProxy : EPF_PersistentScriptedState
 
 class EPF_ScriptedStateSaveData : EPF_MetaDataDbEntity
 {
+	[NonSerialized()]
+	protected string m_sFingerprint;
+
 	//------------------------------------------------------------------------------------------------
 	//! Reads the save-data from the scripted state
 	//! \return EPF_EReadResult.OK if save-data could be read, ERROR if something failed, DEFAULT if the data could be trimmed
@@ -425,7 +454,19 @@ class EPF_ScriptedStateSaveData : EPF_MetaDataDbEntity
 	//! \return true if save-data is considered to describe the same data. False on differences.
 	bool Equals(notnull EPF_ScriptedStateSaveData other)
 	{
-		return EPF_SavaDataUtils.StructAutoCompare(this, other);
+		return GetFingerprint() == other.GetFingerprint();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Comparable representation of the save-data. It is computed once per instance, so the change tracker
+	//! only has to serialize the new save-data and can reuse the fingerprint of the last one.
+	//! Only call once the save-data is fully read and will not be changed anymore.
+	string GetFingerprint()
+	{
+		if (!m_sFingerprint)
+			m_sFingerprint = EPF_SavaDataUtils.GetFingerprint(this);
+
+		return m_sFingerprint;
 	}
 }
 
@@ -1,7 +1,5 @@
 class EPF_PersistentWorldEntityLoader
 {
-	protected static ref map<string, typename> s_mSaveDataTypeCache;
-
 	//------------------------------------------------------------------------------------------------
 	//! Load and spawn an entity by save-data type and persistent id
 	//! \param saveDataType save-data type of the entity
@@ -119,37 +117,7 @@ class EPF_PersistentWorldEntityLoader
 	//------------------------------------------------------------------------------------------------
 	protected static typename GetSaveDataType(string prefab)
 	{
-		if (!s_mSaveDataTypeCache)
-			s_mSaveDataTypeCache = new map<string, typename>();
-
-		typename resultType = s_mSaveDataTypeCache.Get(prefab);
-
-		if (!resultType)
-		{
-			Resource resource = Resource.Load(prefab);
-			if (resource && resource.IsValid())
-			{
-				IEntitySource entitySource = resource.GetResource().ToEntitySource();
-				for (int nComponentSource = 0, count = entitySource.GetComponentCount(); nComponentSource < count; nComponentSource++)
-				{
-					IEntityComponentSource componentSource = entitySource.GetComponent(nComponentSource);
-					typename componentType = componentSource.GetClassName().ToType();
-					if (componentType.IsInherited(EPF_PersistenceComponent))
-					{
-						BaseContainer saveDataContainer = componentSource.GetObject("m_pSaveData");
-						if (saveDataContainer)
-						{
-							resultType = EPF_Utils.TrimEnd(saveDataContainer.GetClassName(), 5).ToType();
-							break;
-						}
-					}
-				}
-			}
-		}
-
-		s_mSaveDataTypeCache.Set(prefab, resultType);
-
-		return resultType;
+		return EPF_PrefabCatalog.GetSaveDataType(prefab);
 	}
 }
 
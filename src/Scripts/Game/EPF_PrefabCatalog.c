@@ -0,0 +1,248 @@
+//! Prefab derived metadata resolved once per prefab and shared by all instances.
+//! Can be kept in a server local cache file, so restarts with the same game and addon versions skip inspecting the prefab resources.
+class EPF_PrefabCatalog
+{
+	protected static const string CACHE_DIRECTORY = "$profile:.epf";
+	protected static const string CACHE_FILE = CACHE_DIRECTORY + "/PrefabCatalog.json";
+
+	protected static ref map<string, ref EPF_PrefabCatalogEntry> s_mEntries;
+	protected static bool s_bDirty;
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the catalog entry of a prefab, created empty if not yet known.
+	//! \param prefab resource name of the prefab or the name of an entity placed without prefab
+	static EPF_PrefabCatalogEntry Get(string prefab)
+	{
+		if (!s_mEntries)
+			s_mEntries = new map<string, ref EPF_PrefabCatalogEntry>();
+
+		EPF_PrefabCatalogEntry entry = s_mEntries.Get(prefab);
+		if (!entry)
+		{
+			entry = new EPF_PrefabCatalogEntry();
+			entry.m_sPrefab = prefab;
+			s_mEntries.Set(prefab, entry);
+		}
+
+		return entry;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the entity save-data type configured on the persistence component of the prefab
+	//! \return save-data type or null if the prefab is invalid or not persistent
+	static typename GetSaveDataType(string prefab)
+	{
+		EPF_PrefabCatalogEntry entry = Get(prefab);
+		if (!entry.m_bSaveDataTypeResolved)
+		{
+			entry.m_sSaveDataType = ReadSaveDataType(prefab);
+			entry.m_bSaveDataTypeResolved = true;
+			MarkDirty();
+		}
+
+		return entry.GetSaveDataType();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the GUID part of a prefab resource name
+	//! \return GUID or the unchanged name for entities placed without prefab
+	static string GetPrefabGUID(string prefab)
+	{
+		return Get(prefab).GetPrefabGUID();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Flag the catalog as changed so the cache file is updated on the next save.
+	static void MarkDirty()
+	{
+		s_bDirty = true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Fill the catalog from the cache file if it was written for the current game and addon versions.
+	static void Load()
+	{
+		#ifndef WORKBENCH // Prefabs can be edited at any time in the workbench
+		if (!FileIO.FileExists(CACHE_FILE))
+			return;
+
+		string version = GetVersion();
+		if (!version)
+		{
+			Print("Prefab catalog cache is not used, because the version of a loaded addon is unknown.", LogLevel.DEBUG);
+			return;
+		}
+
+		SCR_JsonLoadContext reader();
+		EPF_PrefabCatalogCache cache();
+		if (!reader.LoadFromFile(CACHE_FILE) || !reader.ReadValue("", cache) || cache.m_sVersion != version || !cache.m_aEntries)
+		{
+			Print(string.Format("Prefab catalog cache '%1' is outdated or invalid and will be rebuilt.", CACHE_FILE), LogLevel.DEBUG);
+			return;
+		}
+
+		if (!s_mEntries)
+			s_mEntries = new map<string, ref EPF_PrefabCatalogEntry>();
+
+		foreach (EPF_PrefabCatalogEntry entry : cache.m_aEntries)
+		{
+			if (entry && !s_mEntries.Contains(entry.m_sPrefab))
+				s_mEntries.Set(entry.m_sPrefab, entry);
+		}
+		#endif
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Write the catalog to the cache file if it changed since it was loaded or last saved.
+	static void Save()
+	{
+		#ifndef WORKBENCH
+		if (!s_bDirty || !s_mEntries)
+			return;
+
+		string version = GetVersion();
+		if (!version)
+			return;
+
+		EPF_PrefabCatalogCache cache();
+		cache.m_sVersion = version;
+		cache.m_aEntries = {};
+		cache.m_aEntries.Reserve(s_mEntries.Count());
+		foreach (string prefab, EPF_PrefabCatalogEntry entry : s_mEntries)
+		{
+			// Entities placed without prefab are world specific and only cached in memory
+			if (prefab.StartsWith("{"))
+				cache.m_aEntries.Insert(entry);
+		}
+
+		FileIO.MakeDirectory(CACHE_DIRECTORY);
+
+		SCR_JsonSaveContext writer();
+		if (!writer.WriteValue("", cache) || !writer.SaveToFile(CACHE_FILE))
+		{
+			Debug.Error(string.Format("Failed to write prefab catalog cache '%1'.", CACHE_FILE));
+			return;
+		}
+
+		s_bDirty = false;
+		#endif
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static void Reset()
+	{
+		s_mEntries = null;
+		s_bDirty = false;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the key the cache file is valid for. Changes with the game build and the set and versions of loaded addons.
+	//! \return key or empty string if the version of a loaded addon is unknown and the cache must not be used
+	protected static string GetVersion()
+	{
+		string version = GetGame().GetBuildVersion();
+
+		// Workshop addons keep their GUID across updates, so their installed revision is part of the key
+		map<string, string> revisions();
+		WorkshopApi workshop = GetGame().GetBackendApi().GetWorkshop();
+		if (workshop)
+		{
+			array<WorkshopItem> items();
+			workshop.GetDownloadedItems(items);
+			foreach (WorkshopItem item : items)
+			{
+				Revision revision = item.GetActiveRevision();
+				if (revision)
+					revisions.Set(item.Id(), revision.GetVersion());
+			}
+		}
+
+		array<string> addons();
+		GameProject.GetLoadedAddons(addons);
+		foreach (string addon : addons)
+		{
+			// Vanilla addons only change with the game build
+			if (GameProject.IsVanillaAddon(addon))
+			{
+				version += ";" + addon;
+				continue;
+			}
+
+			string revision;
+			if (!revisions.Find(addon, revision) || !revision)
+				return string.Empty;
+
+			version += string.Format(";%1@%2", addon, revision);
+		}
+
+		return version;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static string ReadSaveDataType(string prefab)
+	{
+		Resource resource = Resource.Load(prefab);
+		if (!resource || !resource.IsValid())
+			return string.Empty;
+
+		IEntitySource entitySource = resource.GetResource().ToEntitySource();
+		for (int nComponentSource = 0, count = entitySource.GetComponentCount(); nComponentSource < count; nComponentSource++)
+		{
+			IEntityComponentSource componentSource = entitySource.GetComponent(nComponentSource);
+			typename componentType = componentSource.GetClassName().ToType();
+			if (componentType.IsInherited(EPF_PersistenceComponent))
+			{
+				BaseContainer saveDataContainer = componentSource.GetObject("m_pSaveData");
+				if (saveDataContainer)
+					return EPF_Utils.TrimEnd(saveDataContainer.GetClassName(), 5);
+			}
+		}
+
+		return string.Empty;
+	}
+}
+
+class EPF_PrefabCatalogEntry
+{
+	string m_sPrefab;
+
+	bool m_bSaveDataTypeResolved;
+	string m_sSaveDataType;
+
+	// Null until resolved. Assumes one slot manager per prefab.
+	ref array<ref EPF_EntitySlotPrefabInfo> m_aSlotInfos;
+
+	[NonSerialized()]
+	protected typename m_tSaveDataType;
+
+	[NonSerialized()]
+	protected string m_sPrefabGUID;
+
+	//------------------------------------------------------------------------------------------------
+	typename GetSaveDataType()
+	{
+		if (!m_tSaveDataType && m_sSaveDataType)
+			m_tSaveDataType = m_sSaveDataType.ToType();
+
+		return m_tSaveDataType;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	string GetPrefabGUID()
+	{
+		if (!m_sPrefabGUID)
+		{
+			m_sPrefabGUID = m_sPrefab;
+			if (m_sPrefab.StartsWith("{"))
+				m_sPrefabGUID = EPF_Utils.GetPrefabGUID(m_sPrefab);
+		}
+
+		return m_sPrefabGUID;
+	}
+}
+
+class EPF_PrefabCatalogCache
+{
+	string m_sVersion;
+	ref array<ref EPF_PrefabCatalogEntry> m_aEntries;
+}
@@ -6,6 +6,13 @@ class EPF_SavaDataUtils
 		return GetCleanedComparisonString(a, floatingPrecision) == GetCleanedComparisonString(b, floatingPrecision);
 	}
 
+	//------------------------------------------------------------------------------------------------
+	//! Get a string representation of the instance that can be compared against others, ignoring the last saved timestamp.
+	static string GetFingerprint(notnull Managed inst, bool floatingPrecision = 5)
+	{
+		return GetCleanedComparisonString(inst, floatingPrecision);
+	}
+
 	//------------------------------------------------------------------------------------------------
 	protected static string GetCleanedComparisonString(notnull Managed inst, bool floatingPrecision)
 	{
@@ -0,0 +1,199 @@
+enum EPF_ESaveDataPoolFlags
+{
+	POOLED			= 1,	// Created by the pool for a save operation, so it is safe to be recycled once released
+	RETAINED		= 2,	// Kept by a change tracker for comparison
+	PENDING_WRITE	= 4,	// Submitted to the database and not yet released by it
+	SHARED			= 8		// Can be referenced by multiple other save-data instances
+}
+
+//! Reuses save-data instances across save cycles to reduce allocations and garbage collection churn on large worlds.
+//! Only active if enabled in the persistence manager settings. While active save-data returned by EPF_PersistenceComponent.Save()
+//! and passed to its save events must not be kept beyond the current save operation, as it will be recycled afterwards.
+class EPF_SaveDataPool
+{
+	protected static const int MAX_POOLED_PER_TYPE = 4096;
+
+	protected static bool s_bEnabled;
+	protected static ref map<typename, ref array<ref Managed>> s_mPool;
+	protected static ref array<ref EPF_EntitySaveData> s_aCompletedWrites;
+
+	//------------------------------------------------------------------------------------------------
+	static void SetEnabled(bool enabled)
+	{
+		s_bEnabled = enabled;
+		if (enabled && !s_mPool)
+			s_mPool = new map<typename, ref array<ref Managed>>();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static bool IsEnabled()
+	{
+		return s_bEnabled;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get an instance of the type, reused from the pool if possible.
+	static Managed Get(typename type)
+	{
+		if (s_bEnabled)
+		{
+			array<ref Managed> pooled = s_mPool.Get(type);
+			if (pooled && !pooled.IsEmpty())
+			{
+				int lastIdx = pooled.Count() - 1;
+				Managed instance = pooled.Get(lastIdx);
+				pooled.Remove(lastIdx);
+				return instance;
+			}
+		}
+
+		return type.Spawn();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get entity save-data to be filled by a save operation. It will be eligible for recycling once released.
+	static EPF_EntitySaveData GetEntitySaveData(typename saveDataType)
+	{
+		EPF_EntitySaveData saveData = EPF_EntitySaveData.Cast(Get(saveDataType));
+		if (saveData)
+			saveData.m_ePoolFlags = EPF_ESaveDataPoolFlags.POOLED;
+
+		return saveData;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Mark save-data as kept by a change tracker. Retained save-data and its nested instances are never recycled.
+	static void Retain(notnull EPF_EntitySaveData saveData)
+	{
+		EPF_BitFlags.SetFlags(saveData.m_ePoolFlags, EPF_ESaveDataPoolFlags.RETAINED);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Undo Retain(). The save-data is not released, as it might still be nested in other save-data that will release it.
+	static void Unretain(notnull EPF_EntitySaveData saveData)
+	{
+		EPF_BitFlags.ClearFlags(saveData.m_ePoolFlags, EPF_ESaveDataPoolFlags.RETAINED);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Mark save-data as possibly referenced by multiple other save-data instances. Shared save-data is never recycled.
+	static void Share(notnull EPF_EntitySaveData saveData)
+	{
+		EPF_BitFlags.SetFlags(saveData.m_ePoolFlags, EPF_ESaveDataPoolFlags.SHARED);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get a database operation callback that releases the save-data once the database is done with it.
+	//! \return the callback or null if pooling is disabled
+	static EDF_DbOperationStatusOnlyCallback TrackWrite(notnull EPF_EntitySaveData saveData)
+	{
+		if (!s_bEnabled || !EPF_BitFlags.CheckFlags(saveData.m_ePoolFlags, EPF_ESaveDataPoolFlags.POOLED))
+			return null;
+
+		EPF_BitFlags.SetFlags(saveData.m_ePoolFlags, EPF_ESaveDataPoolFlags.PENDING_WRITE);
+		return new EPF_SaveDataPoolWriteCallback(context: saveData);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Hand entity save-data including all nested save-data back to the pool.
+	//! Save-data that was not created by the pool, is retained or awaits a database write is left untouched.
+	static void Release(EPF_EntitySaveData saveData)
+	{
+		if (!s_bEnabled || !saveData || saveData.m_ePoolFlags != EPF_ESaveDataPoolFlags.POOLED)
+			return;
+
+		if (saveData.Recycle())
+			Store(saveData);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Hand component save-data including all nested entity save-data back to the pool.
+	static void Release(EPF_ComponentSaveData saveData)
+	{
+		if (!s_bEnabled || !saveData)
+			return;
+
+		if (saveData.Recycle())
+			Store(saveData);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Hand a helper instance (e.g. slot wrappers) back to the pool. The caller must have cleared all its fields.
+	static void Return(Managed instance)
+	{
+		if (s_bEnabled && instance)
+			Store(instance);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Release save-data the database is done with. Deferred to the next frame, as drivers may complete a write
+	//! synchronously while the save operation that submitted it is still using the instance.
+	static void OnWriteComplete(EPF_EntitySaveData saveData)
+	{
+		if (!saveData || !s_bEnabled)
+			return;
+
+		if (!s_aCompletedWrites)
+			s_aCompletedWrites = {};
+
+		s_aCompletedWrites.Insert(saveData);
+
+		ScriptCallQueue callQueue = GetGame().GetCallqueue();
+		if (callQueue.GetRemainingTime(ReleaseCompletedWrites) == -1)
+			callQueue.Call(ReleaseCompletedWrites);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static void ReleaseCompletedWrites()
+	{
+		if (!s_aCompletedWrites)
+			return;
+
+		array<ref EPF_EntitySaveData> completedWrites = s_aCompletedWrites;
+		s_aCompletedWrites = null;
+
+		foreach (EPF_EntitySaveData saveData : completedWrites)
+		{
+			EPF_BitFlags.ClearFlags(saveData.m_ePoolFlags, EPF_ESaveDataPoolFlags.PENDING_WRITE);
+			Release(saveData);
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected static void Store(notnull Managed instance)
+	{
+		typename type = instance.Type();
+		array<ref Managed> pooled = s_mPool.Get(type);
+		if (!pooled)
+		{
+			pooled = {};
+			s_mPool.Set(type, pooled);
+		}
+
+		if (pooled.Count() < MAX_POOLED_PER_TYPE)
+			pooled.Insert(instance);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static void Reset()
+	{
+		s_bEnabled = false;
+		s_mPool = null;
+		s_aCompletedWrites = null;
+	}
+}
+
+class EPF_SaveDataPoolWriteCallback : EDF_DbOperationStatusOnlyCallback
+{
+	//------------------------------------------------------------------------------------------------
+	override void OnSuccess(Managed context)
+	{
+		EPF_SaveDataPool.OnWriteComplete(EPF_EntitySaveData.Cast(context));
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override void OnFailure(EDF_EDbOperationStatusCode statusCode, Managed context)
+	{
+		EPF_SaveDataPool.OnWriteComplete(EPF_EntitySaveData.Cast(context));
+	}
+}
@@ -1,11 +1,15 @@
 class EPF_StorageChangeDetection
 {
 	protected static ref set<BaseInventoryStorageComponent> s_aDirtyStorages = new set<BaseInventoryStorageComponent>();
+	protected static ref map<BaseInventoryStorageComponent, int> s_mStorageGenerations = new map<BaseInventoryStorageComponent, int>();
+	protected static ref map<IEntity, int> s_mEntityGenerations = new map<IEntity, int>();
+	protected static int s_iGeneration;
 
 	//------------------------------------------------------------------------------------------------
 	static void SetDirty(notnull BaseInventoryStorageComponent storage)
 	{
 		s_aDirtyStorages.Insert(storage);
+		MarkChanged(storage);
 	}
 
 	//------------------------------------------------------------------------------------------------
@@ -15,13 +19,70 @@ class EPF_StorageChangeDetection
 	}
 
 	//------------------------------------------------------------------------------------------------
-	static void Cleanup(notnull IEntity owner)
+	//! Bump the generation of a storage whose content changed and carry it up through all parent storages and entities to the storage root.
+	static void MarkChanged(notnull BaseInventoryStorageComponent storage)
 	{
-		array<Managed> storages();
-		owner.FindComponents(BaseInventoryStorageComponent, storages);
-		foreach (Managed storageRef : storages)
+		int generation = ++s_iGeneration;
+
+		IEntity owner = storage.GetOwner();
+		BaseInventoryStorageComponent current = storage;
+		while (current)
 		{
-			s_aDirtyStorages.RemoveItem(BaseInventoryStorageComponent.Cast(storageRef));
+			s_mStorageGenerations.Set(current, generation);
+
+			owner = current.GetOwner();
+			if (owner)
+				s_mEntityGenerations.Set(owner, generation);
+
+			InventoryStorageSlot parentSlot = current.GetParentSlot();
+			if (!parentSlot)
+				break;
+
+			current = parentSlot.GetStorage();
+		}
+
+		// Continue through non inventory hierarchy (e.g. entity slots) up to the world root
+		if (owner)
+			owner = owner.GetParent();
+
+		while (owner)
+		{
+			s_mEntityGenerations.Set(owner, generation);
+			owner = owner.GetParent();
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the generation of the last change inside the storage or any storage nested in it. 0 if unchanged.
+	static int GetGeneration(notnull BaseInventoryStorageComponent storage)
+	{
+		return s_mStorageGenerations.Get(storage);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get the generation of the last storage change anywhere inside the entity hierarchy. 0 if unchanged.
+	static int GetGeneration(notnull IEntity entity)
+	{
+		return s_mEntityGenerations.Get(entity);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Check if anything was inserted or removed in any storage inside the entity hierarchy since the given generation.
+	static bool HasChangedSince(notnull IEntity entity, int generation)
+	{
+		return s_mEntityGenerations.Get(entity) > generation;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	static void Cleanup(notnull IEntity owner, notnull array<BaseInventoryStorageComponent> storages)
+	{
+		s_mEntityGenerations.Remove(owner);
+
+		foreach (BaseInventoryStorageComponent storage : storages)
+		{
+			s_aDirtyStorages.RemoveItem(storage);
+			s_mStorageGenerations.Remove(storage);
+			EPF_BakedStorageChange.Remove(storage);
 		}
 	}
 
@@ -29,13 +90,16 @@ class EPF_StorageChangeDetection
 	static void Reset()
 	{
 		s_aDirtyStorages = new set<BaseInventoryStorageComponent>();
+		s_mStorageGenerations = new map<BaseInventoryStorageComponent, int>();
+		s_mEntityGenerations = new map<IEntity, int>();
+		s_iGeneration = 0;
 		EPF_BakedStorageChange.Reset();
 	}
 };
 
 class EPF_BakedStorageChange
 {
-	protected static ref map<string, ref EPF_BakedStorageChange> s_mStorageChanges = new map<string, ref EPF_BakedStorageChange>();
+	protected static ref map<BaseInventoryStorageComponent, ref EPF_BakedStorageChanges> s_mStorageChanges = new map<BaseInventoryStorageComponent, ref EPF_BakedStorageChanges>();
 
 	string m_sRemovedItemId;
 	bool m_bReplaced;
@@ -46,8 +110,7 @@ class EPF_BakedStorageChange
 		int slotId = parentSlot.GetID();
 		BaseInventoryStorageComponent storage = parentSlot.GetStorage();
 
-		string storageKey = string.Format("%1:%2", storage, slotId);
-		EPF_BakedStorageChange change = s_mStorageChanges.Get(storageKey);
+		EPF_BakedStorageChange change = Get(storage, slotId);
 		if (!change)
 		{
 			change = new EPF_BakedStorageChange();
@@ -60,39 +123,40 @@ class EPF_BakedStorageChange
 
 		if (!change)
 		{
-			//PrintFormat("Baked %1 was returned to default because removed item was added back.", storageKey);
-			s_mStorageChanges.Remove(storageKey);
+			//PrintFormat("Baked %1:%2 was returned to default because removed item was added back.", storage, slotId);
+			Set(storage, slotId, null);
 			return;
 		}
 
-		//PrintFormat("Baked %1 was changed with new item in slot.", storageKey);
+		//PrintFormat("Baked %1:%2 was changed with new item in slot.", storage, slotId);
 		change.m_bReplaced = true;
-		s_mStorageChanges.Set(storageKey, change);
+		Set(storage, slotId, change);
 	}
 
 	//------------------------------------------------------------------------------------------------
 	static void OnRemoved(EPF_PersistenceComponent childPersistence, InventoryStorageSlot parentSlot)
 	{
-		string storageKey = string.Format("%1:%2", parentSlot.GetStorage(), parentSlot.GetID());
+		int slotId = parentSlot.GetID();
+		BaseInventoryStorageComponent storage = parentSlot.GetStorage();
 
-		EPF_BakedStorageChange change = s_mStorageChanges.Get(storageKey);
+		EPF_BakedStorageChange change = Get(storage, slotId);
 		if (!change && EPF_BitFlags.CheckFlags(childPersistence.GetFlags(), EPF_EPersistenceFlags.BAKED))
 		{
 			change = new EPF_BakedStorageChange();
 			change.m_sRemovedItemId = childPersistence.GetPersistentId();
-			//PrintFormat("Baked %1 was changed because baked item was removed.", storageKey);
-			s_mStorageChanges.Set(storageKey, change);
+			//PrintFormat("Baked %1:%2 was changed because baked item was removed.", storage, slotId);
+			Set(storage, slotId, change);
 		}
 		else if (change)
 		{
 			if (!change.m_sRemovedItemId)
 			{
-				//PrintFormat("Baked %1 was returned to default because added dynamic item was removed again.", storageKey);
-				s_mStorageChanges.Remove(storageKey);
+				//PrintFormat("Baked %1:%2 was returned to default because added dynamic item was removed again.", storage, slotId);
+				Set(storage, slotId, null);
 				return;
 			}
 
-			//PrintFormat("Baked %1 is still removed, but no longer replaced.", storageKey);
+			//PrintFormat("Baked %1:%2 is still removed, but no longer replaced.", storage, slotId);
 			change.m_bReplaced = false;
 		}
 	}
@@ -100,28 +164,106 @@ class EPF_BakedStorageChange
 	//------------------------------------------------------------------------------------------------
 	static bool Has(BaseInventoryStorageComponent storage, int slotId)
 	{
-		string storageKey = string.Format("%1:%2", storage, slotId);
-		return s_mStorageChanges.Contains(storageKey);
+		return Get(storage, slotId) != null;
 	}
 
 	//------------------------------------------------------------------------------------------------
 	static EPF_BakedStorageChange Get(BaseInventoryStorageComponent storage, int slotId)
 	{
-		string storageKey = string.Format("%1:%2", storage, slotId);
-		return s_mStorageChanges.Get(storageKey);
+		EPF_BakedStorageChanges changes = s_mStorageChanges.Get(storage);
+		if (!changes)
+			return null;
+
+		return changes.Get(slotId);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Get all recorded changes of a storage to look up multiple slots without repeated map access.
+	//! \return slot indexed changes or null if there are none
+	static EPF_BakedStorageChanges GetAll(BaseInventoryStorageComponent storage)
+	{
+		return s_mStorageChanges.Get(storage);
 	}
 
 	//------------------------------------------------------------------------------------------------
+	//! Record a change for the storage slot. Passing null removes any recorded change.
 	static void Set(BaseInventoryStorageComponent storage, int slotId, EPF_BakedStorageChange change)
 	{
-		string storageKey = string.Format("%1:%2", storage, slotId);
-		s_mStorageChanges.Set(storageKey, change);
+		EPF_BakedStorageChanges changes = s_mStorageChanges.Get(storage);
+		if (!changes)
+		{
+			if (!change)
+				return;
+
+			changes = new EPF_BakedStorageChanges();
+			s_mStorageChanges.Set(storage, changes);
+		}
+
+		changes.Set(slotId, change);
+
+		if (changes.IsEmpty())
+			s_mStorageChanges.Remove(storage);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Drop all recorded changes of a storage that is about to be deleted
+	static void Remove(BaseInventoryStorageComponent storage)
+	{
+		s_mStorageChanges.Remove(storage);
 	}
 
 	//------------------------------------------------------------------------------------------------
 	static void Reset()
 	{
 		// Create a new map for next game start
-		s_mStorageChanges = new map<string, ref EPF_BakedStorageChange>();
+		s_mStorageChanges = new map<BaseInventoryStorageComponent, ref EPF_BakedStorageChanges>();
+	}
+};
+
+//! Slot indexed changes of a single baked storage
+class EPF_BakedStorageChanges
+{
+	protected ref array<ref EPF_BakedStorageChange> m_aSlots = {};
+	protected int m_iCount;
+
+	//------------------------------------------------------------------------------------------------
+	EPF_BakedStorageChange Get(int slotId)
+	{
+		if (slotId < 0 || slotId >= m_aSlots.Count())
+			return null;
+
+		return m_aSlots.Get(slotId);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void Set(int slotId, EPF_BakedStorageChange change)
+	{
+		if (slotId < 0)
+			return;
+
+		if (slotId >= m_aSlots.Count())
+		{
+			if (!change)
+				return;
+
+			m_aSlots.Resize(slotId + 1);
+		}
+
+		EPF_BakedStorageChange previous = m_aSlots.Get(slotId);
+		if (previous == change)
+			return;
+
+		if (!previous)
+			m_iCount++;
+		else if (!change)
+			m_iCount--;
+
+		m_aSlots.Set(slotId, change);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	bool IsEmpty()
+	{
+		return m_iCount == 0;
 	}
 };
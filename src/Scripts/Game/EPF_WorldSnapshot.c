@@ -0,0 +1,121 @@
+//! Save-data of all initial world entities packed into a single server local file on shutdown.
+//! Only valid for the database state it was written for, identified by the epoch stored in the root entity collection.
+class EPF_WorldSnapshot
+{
+	protected static const string SNAPSHOT_DIRECTORY = "$profile:.epf";
+	protected static const string SNAPSHOT_FILE = SNAPSHOT_DIRECTORY + "/WorldSnapshot.bin";
+
+	int m_iEpoch;
+	ref array<ref EPF_WorldSnapshotEntry> m_aEntries = {};
+
+	[NonSerialized()]
+	protected ref map<string, EPF_EntitySaveData> m_mIndex;
+
+	//------------------------------------------------------------------------------------------------
+	//! Add the save-data of an entity to be written with the snapshot
+	void Add(notnull EPF_EntitySaveData saveData)
+	{
+		EPF_WorldSnapshotEntry entry();
+		entry.m_pSaveData = saveData;
+		m_aEntries.Insert(entry);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Take the save-data of an entity out of the snapshot
+	//! \return save-data or null if the entity is not part of the snapshot
+	EPF_EntitySaveData Take(string persistentId)
+	{
+		if (!m_mIndex)
+		{
+			m_mIndex = new map<string, EPF_EntitySaveData>();
+			foreach (EPF_WorldSnapshotEntry entry : m_aEntries)
+			{
+				if (entry.m_pSaveData)
+					m_mIndex.Set(entry.m_pSaveData.GetId(), entry.m_pSaveData);
+			}
+		}
+
+		EPF_EntitySaveData saveData = m_mIndex.Get(persistentId);
+		if (saveData)
+			m_mIndex.Remove(persistentId);
+
+		return saveData;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	int Count()
+	{
+		return m_aEntries.Count();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Read the snapshot file if it was written for the given epoch
+	//! \return snapshot or null if there is none, it is outdated or can not be read
+	static EPF_WorldSnapshot Load(int epoch)
+	{
+		if (epoch == 0 || !FileIO.FileExists(SNAPSHOT_FILE))
+			return null;
+
+		SCR_BinLoadContext reader();
+		EPF_WorldSnapshot snapshot();
+		if (!reader.LoadFromFile(SNAPSHOT_FILE) || !reader.ReadValue("", snapshot) || snapshot.m_iEpoch != epoch)
+		{
+			Print(string.Format("World snapshot '%1' does not match the database and is ignored.", SNAPSHOT_FILE), LogLevel.DEBUG);
+			return null;
+		}
+
+		return snapshot;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Write the snapshot file, replacing the previous one
+	bool Save()
+	{
+		FileIO.MakeDirectory(SNAPSHOT_DIRECTORY);
+
+		SCR_BinSaveContext writer();
+		if (!writer.WriteValue("", this) || !writer.SaveToFile(SNAPSHOT_FILE))
+		{
+			Debug.Error(string.Format("Failed to write world snapshot '%1'.", SNAPSHOT_FILE));
+			return false;
+		}
+
+		return true;
+	}
+}
+
+class EPF_WorldSnapshotEntry
+{
+	ref EPF_EntitySaveData m_pSaveData;
+
+	//------------------------------------------------------------------------------------------------
+	protected bool SerializationSave(BaseSerializationSaveContext saveContext)
+	{
+		if (!saveContext.IsValid())
+			return false;
+
+		saveContext.WriteValue("_type", EDF_DbName.Get(m_pSaveData.Type()));
+		saveContext.WriteValue("m_pSaveData", m_pSaveData);
+
+		return true;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	protected bool SerializationLoad(BaseSerializationLoadContext loadContext)
+	{
+		if (!loadContext.IsValid())
+			return false;
+
+		string dataTypeString;
+		loadContext.ReadValue("_type", dataTypeString);
+
+		typename dataType = EDF_DbName.GetTypeByName(dataTypeString);
+		if (!dataType)
+			return false;
+
+		m_pSaveData = EPF_EntitySaveData.Cast(dataType.Spawn());
+		loadContext.ReadValue("m_pSaveData", m_pSaveData);
+
+		return true;
+	}
+}
@@ -3,6 +3,10 @@ class EPF_WorldUtils
 	protected static ResourceName s_pQueryPrefab;
 	protected static IEntity s_pQueryResult;
 
+	protected static bool s_bDeferUpdates;
+	protected static ref set<IEntity> s_aDeferredUpdates;
+	protected static ref map<IEntity, vector> s_mDeferredMovements;
+
 	//------------------------------------------------------------------------------------------------
 	static IEntity FindNearestPrefab(ResourceName prefab, vector origin, float radius)
 	{
@@ -108,11 +112,75 @@ class EPF_WorldUtils
 			physics.SetAngularVelocity(vector.Zero);
 		}
 
-		RplComponent replication = EPF_Component<RplComponent>.Find(entity);
-		if (replication)
-			replication.ForceNodeMovement(previousOrigin);
+		if (s_bDeferUpdates)
+		{
+			// Replication only needs to know where the entity was before the first move
+			if (!s_mDeferredMovements.Contains(entity))
+				s_mDeferredMovements.Set(entity, previousOrigin);
+		}
+		else
+		{
+			RplComponent replication = EPF_Component<RplComponent>.Find(entity);
+			if (replication)
+				replication.ForceNodeMovement(previousOrigin);
+		}
 
 		if (!ChimeraCharacter.Cast(entity))
-			entity.Update();
+			UpdateEntity(entity);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Update the entity, or once at the end of the batch if updates are currently deferred
+	static void UpdateEntity(notnull IEntity entity)
+	{
+		if (s_bDeferUpdates)
+		{
+			s_aDeferredUpdates.Insert(entity);
+			return;
+		}
+
+		entity.Update();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Collect entity updates and replication movements of the following transform changes, until EndDeferredUpdates is called.
+	//! Used to apply many entities in one frame with only a single update per entity.
+	static void BeginDeferredUpdates()
+	{
+		s_bDeferUpdates = true;
+
+		if (!s_aDeferredUpdates)
+		{
+			s_aDeferredUpdates = new set<IEntity>();
+			s_mDeferredMovements = new map<IEntity, vector>();
+		}
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Execute all updates collected since BeginDeferredUpdates and go back to updating immediately
+	static void EndDeferredUpdates()
+	{
+		if (!s_bDeferUpdates)
+			return;
+
+		s_bDeferUpdates = false;
+
+		foreach (IEntity entity, vector previousOrigin : s_mDeferredMovements)
+		{
+			if (!entity)
+				continue;
+
+			RplComponent replication = EPF_Component<RplComponent>.Find(entity);
+			if (replication)
+				replication.ForceNodeMovement(previousOrigin);
+		}
+		s_mDeferredMovements.Clear();
+
+		foreach (IEntity entity : s_aDeferredUpdates)
+		{
+			if (entity)
+				entity.Update();
+		}
+		s_aDeferredUpdates.Clear();
 	}
 }
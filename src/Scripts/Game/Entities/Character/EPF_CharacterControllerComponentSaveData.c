@@ -10,6 +10,11 @@ class EPF_CharacterControllerComponentSaveDataClass : EPF_ComponentSaveDataClass
 [EDF_DbName.Automatic()]
 class EPF_CharacterControllerComponentSaveData : EPF_ComponentSaveData
 {
+	protected static int s_iStanceChangedHandle = EPF_DeferredApplyResult.RegisterIdentifier("CharacterControllerComponentSaveData::StanceChanged");
+	protected static int s_iRightHandItemEquippedHandle = EPF_DeferredApplyResult.RegisterIdentifier("CharacterControllerComponentSaveData::RightHandItemEquipped");
+	protected static int s_iWeaponRaisedHandle = EPF_DeferredApplyResult.RegisterIdentifier("CharacterControllerComponentSaveData::WeaponRaised");
+	protected static int s_iGadgetEquippedHandle = EPF_DeferredApplyResult.RegisterIdentifier("CharacterControllerComponentSaveData::GadgetEquipped");
+
 	ECharacterStance m_eStance;
 	string m_sLeftHandItemId;
 	string m_sRightHandItemId;
@@ -84,7 +89,7 @@ class EPF_CharacterControllerComponentSaveData : EPF_ComponentSaveData
 			}
 
 			result = EPF_EApplyResult.AWAIT_COMPLETION;
-			EPF_DeferredApplyResult.AddPending(this, "CharacterControllerComponentSaveData::StanceChanged");
+			EPF_DeferredApplyResult.AddPending(this, s_iStanceChangedHandle);
 			GetGame().GetCallqueue().CallLater(ListenForStanceChangeComplete, m_pCharacterController.GetStanceChangeDelayTime() * 1000, true);
 		}
 
@@ -100,7 +105,7 @@ class EPF_CharacterControllerComponentSaveData : EPF_ComponentSaveData
 				if (!curWeaponSlot || curWeaponSlot.GetWeaponEntity() != rightHandEntity)
 				{
 					// Because of MP ownership transfer mid animation issues, we wait for the animation event of weapon change instead of the weapon manager scripted events
-					EPF_DeferredApplyResult.AddPending(this, "CharacterControllerComponentSaveData::RightHandItemEquipped");
+					EPF_DeferredApplyResult.AddPending(this, s_iRightHandItemEquippedHandle);
 					m_pCharacterController.GetOnAnimationEvent().Insert(ListenForWeaponEquipComplete);
 					m_pCharacterController.TryEquipRightHandItem(rightHandEntity, m_eRightHandType, false);
 				}
@@ -118,7 +123,7 @@ class EPF_CharacterControllerComponentSaveData : EPF_ComponentSaveData
 			SCR_GadgetManagerComponent gadgetMananger = SCR_GadgetManagerComponent.GetGadgetManager(m_pCharacterController.GetOwner());
 			if (gadgetMananger)
 			{
-				EPF_DeferredApplyResult.AddPending(this, "CharacterControllerComponentSaveData::GadgetEquipped");
+				EPF_DeferredApplyResult.AddPending(this, s_iGadgetEquippedHandle);
 				gadgetMananger.GetOnGadgetInitDoneInvoker().Insert(OnGadgetInitDone);
 				result = EPF_EApplyResult.AWAIT_COMPLETION;
 			}
@@ -134,7 +139,7 @@ class EPF_CharacterControllerComponentSaveData : EPF_ComponentSaveData
 			return;
 
 		GetGame().GetCallqueue().Remove(ListenForStanceChangeComplete);
-		EPF_DeferredApplyResult.SetFinished(this, "CharacterControllerComponentSaveData::StanceChanged");
+		EPF_DeferredApplyResult.SetFinished(this, s_iStanceChangedHandle);
 	}
 
 	//------------------------------------------------------------------------------------------------
@@ -154,13 +159,13 @@ class EPF_CharacterControllerComponentSaveData : EPF_ComponentSaveData
 			StartInitGadget();
 		}
 
-		EPF_DeferredApplyResult.SetFinished(this, "CharacterControllerComponentSaveData::RightHandItemEquipped");
+		EPF_DeferredApplyResult.SetFinished(this, s_iRightHandItemEquippedHandle);
 	}
 
 	//------------------------------------------------------------------------------------------------
 	protected void StartWeaponRaise()
 	{
-		EPF_DeferredApplyResult.AddPending(this, "CharacterControllerComponentSaveData::WeaponRaised");
+		EPF_DeferredApplyResult.AddPending(this, s_iWeaponRaisedHandle);
 		m_pCharacterController.SetWeaponRaised(true);
 
 		// There is a "StanceTrans" event for when char is erect, but in crouch there is no anim event we could wait for, so for now we just hardcode it.
@@ -174,13 +179,13 @@ class EPF_CharacterControllerComponentSaveData : EPF_ComponentSaveData
 		if (m_sLeftHandItemId)
 			StartInitGadget();
 
-		EPF_DeferredApplyResult.SetFinished(this, "CharacterControllerComponentSaveData::WeaponRaised");
+		EPF_DeferredApplyResult.SetFinished(this, s_iWeaponRaisedHandle);
 	}
 
 	//------------------------------------------------------------------------------------------------
 	protected void StartInitGadget()
 	{
-		EPF_DeferredApplyResult.AddPending(this, "CharacterControllerComponentSaveData::GadgetEquipped");
+		EPF_DeferredApplyResult.AddPending(this, s_iGadgetEquippedHandle);
 		IEntity owner = m_pCharacterController.GetOwner();
 		OnGadgetInitDone(owner, SCR_GadgetManagerComponent.GetGadgetManager(owner));
 	}
@@ -212,7 +217,7 @@ class EPF_CharacterControllerComponentSaveData : EPF_ComponentSaveData
 	//------------------------------------------------------------------------------------------------
 	protected void OnGadgetStateChangedCompleted()
 	{
-		EPF_DeferredApplyResult.SetFinished(this, "CharacterControllerComponentSaveData::GadgetEquipped");
+		EPF_DeferredApplyResult.SetFinished(this, s_iGadgetEquippedHandle);
 	}
 
 	//------------------------------------------------------------------------------------------------
@@ -23,6 +23,7 @@ class EPF_BaseRespawnSystemComponent : SCR_RespawnSystemComponent
 	#endif
 
 	protected ref map<int, IEntity> m_mLoadingCharacters = new map<int, IEntity>();
+	protected ref map<int, ref EPF_CharacterLoadContext> m_mCharacterLoads = new map<int, ref EPF_CharacterLoadContext>();
 	protected PlayerManager m_pPlayerManager;
 
 	//------------------------------------------------------------------------------------------------
@@ -207,12 +208,14 @@ class EPF_BaseRespawnSystemComponent : SCR_RespawnSystemComponent
 
 			if (EPF_DeferredApplyResult.IsPending(saveData))
 			{
-				Tuple3<int, EPF_CharacterSaveData, EPF_PersistenceComponent> context(playerId, saveData, persistenceComponent);
-				EDF_ScriptInvokerCallback callback(this, "OnCharacterLoadCompleteCallback", context);
-				persistenceComponent.GetOnAfterLoadEvent().Insert(callback.Invoke);
+				EPF_CharacterLoadContext context(this, playerId, saveData, persistenceComponent);
+				context.m_pCallback = new EDF_ScriptInvokerCallback(this, "OnCharacterLoadCompleteCallback", context);
+				persistenceComponent.GetOnAfterLoadEvent().Insert(context.m_pCallback.Invoke);
+				m_mCharacterLoads.Set(playerId, context);
 
+				// Handed over on the after load event. The time limit is only a fallback for loads that never complete.
 				// TODO: Remove hard loading time limit when we know all spawn block bugs are fixed.
-				GetGame().GetCallqueue().CallLater(OnCharacterLoadComplete, 5000, false, playerId, saveData, persistenceComponent);
+				GetGame().GetCallqueue().CallLater(context.OnTimeout, 5000);
 			}
 			else
 			{
@@ -227,8 +230,18 @@ class EPF_BaseRespawnSystemComponent : SCR_RespawnSystemComponent
 	/*protected --Hotfix for 1.0 DO NOT CALL THIS MANUALLY*/
 	void OnCharacterLoadCompleteCallback(Managed context)
 	{
-		auto typedContext = Tuple3<int, EPF_CharacterSaveData, EPF_PersistenceComponent>.Cast(context);
-		OnCharacterLoadComplete(typedContext.param1, typedContext.param2, typedContext.param3);
+		EPF_CharacterLoadContext typedContext = EPF_CharacterLoadContext.Cast(context);
+
+		// We only want to know this once, from whichever of the event or the time limit comes first
+		GetGame().GetCallqueue().Remove(typedContext.OnTimeout);
+		if (typedContext.m_pPersistenceComponent)
+			typedContext.m_pPersistenceComponent.GetOnAfterLoadEvent().Remove(typedContext.m_pCallback.Invoke);
+
+		// The callback references the context, so release both
+		typedContext.m_pCallback = null;
+		m_mCharacterLoads.Remove(typedContext.m_iPlayerId);
+
+		OnCharacterLoadComplete(typedContext.m_iPlayerId, typedContext.m_pSaveData, typedContext.m_pPersistenceComponent);
 	}
 
 	//------------------------------------------------------------------------------------------------
@@ -237,9 +250,6 @@ class EPF_BaseRespawnSystemComponent : SCR_RespawnSystemComponent
 		if (!persistenceComponent || !saveData)
 			return;
 
-		// We only want to know this once
-		persistenceComponent.GetOnAfterLoadEvent().Remove(OnCharacterLoadComplete);
-
 		IEntity playerEntity = persistenceComponent.GetOwner();
 		if (m_pPlayerManager.GetPlayerControlledEntity(playerId) == playerEntity)
 			return; // Player was force taken over after the time limit
@@ -382,3 +392,29 @@ class EPF_BaseRespawnSystemComponent : SCR_RespawnSystemComponent
 		// Skip base impementation because of hard wired respawn system aspects we do not make us of.
 	}
 }
+
+class EPF_CharacterLoadContext
+{
+	EPF_BaseRespawnSystemComponent m_pRespawnSystem;
+	int m_iPlayerId;
+	ref EPF_CharacterSaveData m_pSaveData;
+	EPF_PersistenceComponent m_pPersistenceComponent;
+	ref EDF_ScriptInvokerCallback m_pCallback;
+
+	//------------------------------------------------------------------------------------------------
+	//! Fallback for loads that never complete. Bound to this instance, so it can be cancelled per player.
+	void OnTimeout()
+	{
+		if (m_pRespawnSystem)
+			m_pRespawnSystem.OnCharacterLoadCompleteCallback(this);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void EPF_CharacterLoadContext(EPF_BaseRespawnSystemComponent respawnSystem, int playerId, EPF_CharacterSaveData saveData, EPF_PersistenceComponent persistenceComponent)
+	{
+		m_pRespawnSystem = respawnSystem;
+		m_iPlayerId = playerId;
+		m_pSaveData = saveData;
+		m_pPersistenceComponent = persistenceComponent;
+	}
+}
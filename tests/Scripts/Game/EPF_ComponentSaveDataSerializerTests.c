@@ -0,0 +1,107 @@
+class EPF_ComponentSaveDataSerializerTests : TestSuite
+{
+}
+
+class EPF_Test_CountingComponentSerializer : EPF_TypedComponentSaveDataSerializer<EPF_Test_SerializedComponentSaveData, GenericComponent>
+{
+	int m_iReads;
+
+	//------------------------------------------------------------------------------------------------
+	override protected EPF_EReadResult ReadTyped(EPF_Test_SerializedComponentSaveData saveData, IEntity owner, GenericComponent component, EPF_ComponentSaveDataClass attributes)
+	{
+		m_iReads++;
+		saveData.m_iNumber = 42;
+		return EPF_EReadResult.OK;
+	}
+}
+
+[EPF_ComponentSaveDataSerializerType(EPF_Test_CountingComponentSerializer)]
+class EPF_Test_SerializedComponentSaveData : EPF_ComponentSaveData
+{
+	int m_iNumber;
+}
+
+class EPF_Test_DerivedMagazineComponentSaveData : EPF_BaseMagazineComponentSaveData
+{
+	int m_iExtra;
+}
+
+[Test("EPF_ComponentSaveDataSerializerTests")]
+class EPF_Test_ComponentSaveDataSerializer_ReadFrom_Registered_PreferredOverAutoCopy : TestBase
+{
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	void ActAndAssert()
+	{
+		EPF_Test_CountingComponentSerializer serializer = EPF_Test_CountingComponentSerializer.Cast(
+			EPF_ComponentSaveDataSerializerType.Get(EPF_Test_SerializedComponentSaveData));
+
+		// Act
+		EPF_Test_SerializedComponentSaveData saveData();
+		EPF_EReadResult result = saveData.ReadFrom(null, null, new EPF_ComponentSaveDataClass());
+
+		// Assert
+		SetResult(new EDF_TestResult(
+			serializer &&
+			serializer.m_iReads == 1 &&
+			result == EPF_EReadResult.OK &&
+			saveData.m_iNumber == 42));
+	}
+}
+
+[Test("EPF_ComponentSaveDataSerializerTests")]
+class EPF_Test_ComponentSaveDataSerializer_BuiltIn_Registered : TestBase
+{
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	void ActAndAssert()
+	{
+		EPF_ComponentSaveDataSerializer magazine = EPF_ComponentSaveDataSerializerType.Get(EPF_BaseMagazineComponentSaveData);
+		EPF_ComponentSaveDataSerializer hitZones = EPF_ComponentSaveDataSerializerType.Get(EPF_HitZoneContainerComponentSaveData);
+
+		// Derived types inherit the logic, but not the encoding as they may add fields
+		EPF_ComponentSaveDataSerializer derived = EPF_ComponentSaveDataSerializerType.Get(EPF_Test_DerivedMagazineComponentSaveData);
+
+		SetResult(new EDF_TestResult(
+			EPF_BaseMagazineComponentSerializer.Cast(magazine) &&
+			EPF_HitZoneContainerComponentSerializer.Cast(hitZones) &&
+			derived == magazine &&
+			EPF_ComponentSaveDataSerializerType.GetEncoder(EPF_BaseMagazineComponentSaveData) == magazine &&
+			!EPF_ComponentSaveDataSerializerType.GetEncoder(EPF_HitZoneContainerComponentSaveData) &&
+			!EPF_ComponentSaveDataSerializerType.GetEncoder(EPF_Test_DerivedMagazineComponentSaveData)));
+	}
+}
+
+[Test("EPF_ComponentSaveDataSerializerTests")]
+class EPF_Test_ComponentSaveDataSerializer_Encode_RoundTrip_KeepsFieldNames : TestBase
+{
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	void ActAndAssert()
+	{
+		EPF_BaseMagazineComponentSaveData magazine();
+		magazine.m_iAmmoCount = 7;
+
+		EPF_PersistentComponentSaveData persistentComponent();
+		persistentComponent.m_pData = magazine;
+
+		// Act
+		SCR_JsonSaveContext writer();
+		writer.WriteValue("", persistentComponent);
+		string encoded = writer.ExportToString();
+
+		EPF_PersistentComponentSaveData loaded();
+		SCR_JsonLoadContext reader();
+		reader.ImportFromString(encoded);
+		reader.ReadValue("", loaded);
+
+		// Assert
+		EPF_BaseMagazineComponentSaveData loadedMagazine = EPF_BaseMagazineComponentSaveData.Cast(loaded.m_pData);
+		SetResult(new EDF_TestResult(
+			loadedMagazine &&
+			loadedMagazine.m_iAmmoCount == 7 &&
+			loadedMagazine.m_iDataLayoutVersion == magazine.m_iDataLayoutVersion &&
+			encoded.Contains("\"m_pData\"") &&
+			encoded.Contains("\"m_iAmmoCount\"")));
+	}
+}
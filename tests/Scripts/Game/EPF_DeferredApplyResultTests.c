@@ -0,0 +1,238 @@
+class EPF_DeferredApplyResultTests : TestSuite
+{
+}
+
+class EPF_Test_DeferredApplyResultBase : TestBase
+{
+	protected static int s_iFirstHandle = EPF_DeferredApplyResult.RegisterIdentifier("EPF_DeferredApplyResultTests::First");
+	protected static int s_iSecondHandle = EPF_DeferredApplyResult.RegisterIdentifier("EPF_DeferredApplyResultTests::Second");
+	protected static int s_iUnknownHandle = EPF_DeferredApplyResult.RegisterIdentifier("EPF_DeferredApplyResultTests::Unknown");
+
+	ref EPF_EntitySaveData m_pSaveData;
+	int m_iApplied;
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Setup)]
+	void Arrange()
+	{
+		m_pSaveData = new EPF_ItemSaveData();
+		m_pSaveData.SetId(ClassName());
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void OnApplied(EPF_EntitySaveData saveData)
+	{
+		if (saveData == m_pSaveData)
+			m_iApplied++;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.TearDown)]
+	void Cleanup()
+	{
+		m_pSaveData = null;
+	}
+}
+
+[Test("EPF_DeferredApplyResultTests", 3)]
+class EPF_Test_DeferredApplyResult_SetFinished_OnlyMatchingIdentifier_Completes : EPF_Test_DeferredApplyResultBase
+{
+	bool m_bAppliedEarly;
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	void Act()
+	{
+		EPF_DeferredApplyResult.AddPending(m_pSaveData, s_iFirstHandle);
+		EPF_DeferredApplyResult.AddPending(m_pSaveData, s_iSecondHandle);
+		EPF_DeferredApplyResult.GetOnApplied(m_pSaveData).Insert(OnApplied);
+
+		// Neither unknown identifiers nor finishing the same work twice may complete the other one
+		EPF_DeferredApplyResult.SetFinished(m_pSaveData, s_iUnknownHandle);
+		EPF_DeferredApplyResult.SetFinished(m_pSaveData, s_iFirstHandle);
+		EPF_DeferredApplyResult.SetFinished(m_pSaveData, s_iFirstHandle);
+
+		GetGame().GetCallqueue().CallLater(FinishSecond, 100);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void FinishSecond()
+	{
+		m_bAppliedEarly = m_iApplied > 0;
+		EPF_DeferredApplyResult.SetFinished(m_pSaveData, s_iSecondHandle);
+		GetGame().GetCallqueue().CallLater(Assert, 100);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void Assert()
+	{
+		SetResult(new EDF_TestResult(
+			!m_bAppliedEarly &&
+			m_iApplied == 1 &&
+			!EPF_DeferredApplyResult.IsPending(m_pSaveData)));
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	bool AwaitResult()
+	{
+		return GetResult();
+	}
+}
+
+[Test("EPF_DeferredApplyResultTests")]
+class EPF_Test_DeferredApplyResult_RegisterIdentifier_SameName_SameHandle : TestBase
+{
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	void ActAndAssert()
+	{
+		int first = EPF_DeferredApplyResult.RegisterIdentifier("EPF_DeferredApplyResultTests::Registered");
+		int second = EPF_DeferredApplyResult.RegisterIdentifier("EPF_DeferredApplyResultTests::Registered");
+		int other = EPF_DeferredApplyResult.RegisterIdentifier("EPF_DeferredApplyResultTests::Other");
+
+		SetResult(new EDF_TestResult(
+			first > 0 &&
+			first == second &&
+			other != first &&
+			EPF_DeferredApplyResult.GetIdentifier(first) == "EPF_DeferredApplyResultTests::Registered"));
+	}
+}
+
+[Test("EPF_DeferredApplyResultTests", 3)]
+class EPF_Test_DeferredApplyResult_AddPending_SameHandleTwice_NeedsTwoFinishes : EPF_Test_DeferredApplyResultBase
+{
+	bool m_bAppliedEarly;
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	void Act()
+	{
+		EPF_DeferredApplyResult.AddPending(m_pSaveData, s_iFirstHandle);
+		EPF_DeferredApplyResult.AddPending(m_pSaveData, s_iFirstHandle);
+		EPF_DeferredApplyResult.GetOnApplied(m_pSaveData).Insert(OnApplied);
+		EPF_DeferredApplyResult.SetFinished(m_pSaveData, s_iFirstHandle);
+
+		GetGame().GetCallqueue().CallLater(FinishSecond, 100);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void FinishSecond()
+	{
+		m_bAppliedEarly = m_iApplied > 0;
+		EPF_DeferredApplyResult.SetFinished(m_pSaveData, s_iFirstHandle);
+		GetGame().GetCallqueue().CallLater(Assert, 100);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void Assert()
+	{
+		SetResult(new EDF_TestResult(
+			!m_bAppliedEarly &&
+			m_iApplied == 1 &&
+			!EPF_DeferredApplyResult.IsPending(m_pSaveData)));
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	bool AwaitResult()
+	{
+		return GetResult();
+	}
+}
+
+[Test("EPF_DeferredApplyResultTests", 3)]
+class EPF_Test_DeferredApplyResult_ComponentPending_EntityFinished_AwaitsComponent : EPF_Test_DeferredApplyResultBase
+{
+	ref EPF_ComponentSaveData m_pComponentSaveData;
+	bool m_bAppliedEarly;
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	void Act()
+	{
+		m_pComponentSaveData = new EPF_ComponentSaveData();
+		EPF_DeferredApplyResult.AddPending(m_pComponentSaveData, s_iSecondHandle);
+		EPF_DeferredApplyResult.SetEntitySaveData(m_pComponentSaveData, m_pSaveData);
+
+		EPF_DeferredApplyResult.AddPending(m_pSaveData, s_iFirstHandle);
+		EPF_DeferredApplyResult.GetOnApplied(m_pSaveData).Insert(OnApplied);
+		EPF_DeferredApplyResult.SetFinished(m_pSaveData, s_iFirstHandle);
+
+		GetGame().GetCallqueue().CallLater(FinishComponent, 100);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void FinishComponent()
+	{
+		m_bAppliedEarly = m_iApplied > 0;
+		EPF_DeferredApplyResult.SetFinished(m_pComponentSaveData, s_iSecondHandle);
+		GetGame().GetCallqueue().CallLater(Assert, 100);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void Assert()
+	{
+		SetResult(new EDF_TestResult(
+			!m_bAppliedEarly &&
+			m_iApplied == 1 &&
+			!EPF_DeferredApplyResult.IsPending(m_pSaveData)));
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	bool AwaitResult()
+	{
+		return GetResult();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override void Cleanup()
+	{
+		m_pComponentSaveData = null;
+		super.Cleanup();
+	}
+}
+
+[Test("EPF_DeferredApplyResultTests", 3)]
+class EPF_Test_DeferredApplyResult_AddPending_NeverFinished_ForcedAfterTimeout : EPF_Test_DeferredApplyResultBase
+{
+	int m_iPreviousTimeout;
+
+	//------------------------------------------------------------------------------------------------
+	override void Arrange()
+	{
+		super.Arrange();
+		m_iPreviousTimeout = EPF_DeferredApplyResult.GetTimeout();
+		EPF_DeferredApplyResult.SetTimeout(1);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	void Act()
+	{
+		EPF_DeferredApplyResult.AddPending(m_pSaveData, s_iFirstHandle);
+		EPF_DeferredApplyResult.GetOnApplied(m_pSaveData).Insert(OnApplied);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override void OnApplied(EPF_EntitySaveData saveData)
+	{
+		super.OnApplied(saveData);
+		SetResult(new EDF_TestResult(m_iApplied == 1));
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	bool AwaitResult()
+	{
+		return GetResult();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	override void Cleanup()
+	{
+		EPF_DeferredApplyResult.SetTimeout(m_iPreviousTimeout);
+		super.Cleanup();
+	}
+}
@@ -0,0 +1,116 @@
+class EPF_InventoryStorageSlotGroupTests : TestSuite
+{
+	ref EDF_DbContext m_pPreviousContext;
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Setup)]
+	void Setup()
+	{
+		// Change db context to in memory for this test suite
+		EPF_PersistenceManager persistenceManager = EPF_PersistenceManager.GetInstance();
+		m_pPreviousContext = persistenceManager.GetDbContext();
+		EDF_InMemoryDbConnectionInfo connectInfo();
+		connectInfo.m_sDatabaseName = "InventoryStorageSlotGroupTests";
+		persistenceManager.SetDbContext(EDF_DbContext.Create(connectInfo));
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.TearDown)]
+	void TearDown()
+	{
+		EPF_PersistenceManager.GetInstance().SetDbContext(m_pPreviousContext);
+		m_pPreviousContext = null;
+	}
+}
+
+class EPF_Test_CollapsibleStorageSaveData : EPF_BaseInventoryStorageComponentSaveData
+{
+	//------------------------------------------------------------------------------------------------
+	void Collapse(notnull array<int> candidates)
+	{
+		CollapseIdenticalSlots(candidates);
+	}
+}
+
+[Test("EPF_InventoryStorageSlotGroupTests", 3)]
+class EPF_Test_InventoryStorageSlotGroup_CollapseIdentical_RoundTripKeepsIds : TestBase
+{
+	ref array<IEntity> m_aItems = {};
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Setup)]
+	void Arrange()
+	{
+		// Two identical items and one at a different position
+		m_aItems.Insert(EPF_Utils.SpawnEntityPrefab("{C95E11C60810F432}Prefabs/Items/Core/Item_Base.et", "0 0 0"));
+		m_aItems.Insert(EPF_Utils.SpawnEntityPrefab("{C95E11C60810F432}Prefabs/Items/Core/Item_Base.et", "0 0 0"));
+		m_aItems.Insert(EPF_Utils.SpawnEntityPrefab("{C95E11C60810F432}Prefabs/Items/Core/Item_Base.et", "1 0 0"));
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	void ActAndAssert()
+	{
+		array<string> ids();
+		EPF_Test_CollapsibleStorageSaveData collapsed();
+		collapsed.m_aSlots = {};
+		foreach (int slotIdx, IEntity item : m_aItems)
+		{
+			EPF_PersistentInventoryStorageSlot slot();
+			slot.m_iSlotIndex = slotIdx * 2;
+			slot.m_pEntity = EPF_Component<EPF_PersistenceComponent>.Find(item).Save();
+			collapsed.m_aSlots.Insert(slot);
+			ids.Insert(slot.m_pEntity.GetId());
+		}
+
+		// Act
+		collapsed.Collapse({0, 1, 2});
+
+		SCR_JsonSaveContext writer();
+		writer.WriteValue("", collapsed);
+
+		EPF_Test_CollapsibleStorageSaveData loaded();
+		SCR_JsonLoadContext reader();
+		reader.ImportFromString(writer.ExportToString());
+		reader.ReadValue("", loaded);
+
+		// Assert
+		bool slotsValid = loaded.m_aSlots &&
+			loaded.m_aSlots.Count() == 1 &&
+			loaded.m_aSlots.Get(0).m_iSlotIndex == 4 &&
+			loaded.m_aSlots.Get(0).m_pEntity.GetId() == ids.Get(2);
+
+		bool groupValid = loaded.m_aSlotGroups && loaded.m_aSlotGroups.Count() == 1;
+		if (groupValid)
+		{
+			EPF_PersistentInventoryStorageSlotGroup slotGroup = loaded.m_aSlotGroups.Get(0);
+			EPF_EntitySaveData first = slotGroup.GetEntity(0);
+			string firstId = first.GetId();
+
+			// Applying the first member must not affect the second one
+			first.m_pTransformation.m_bApplied = true;
+			EPF_EntitySaveData second = slotGroup.GetEntity(1);
+
+			groupValid = slotGroup.m_aSlotIndices.Count() == 2 &&
+				slotGroup.m_aSlotIndices.Get(0) == 0 &&
+				slotGroup.m_aSlotIndices.Get(1) == 2 &&
+				firstId == ids.Get(0) &&
+				second.GetId() == ids.Get(1) &&
+				!second.m_pTransformation.m_bApplied &&
+				EPF_BitFlags.CheckFlags(second.m_ePoolFlags, EPF_ESaveDataPoolFlags.SHARED);
+		}
+
+		SetResult(new EDF_TestResult(slotsValid && groupValid));
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.TearDown)]
+	void Cleanup()
+	{
+		foreach (IEntity item : m_aItems)
+		{
+			SCR_EntityHelper.DeleteEntityAndChildren(item);
+		}
+		m_aItems = null;
+	}
+}
@@ -0,0 +1,173 @@
+class EPF_SaveDataPoolTests : TestSuite
+{
+	ref EDF_DbContext m_pPreviousContext;
+	bool m_bPreviousPoolEnabled;
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Setup)]
+	void Setup()
+	{
+		// Change db context to in memory for this test suite
+		EPF_PersistenceManager persistenceManager = EPF_PersistenceManager.GetInstance();
+		m_pPreviousContext = persistenceManager.GetDbContext();
+		EDF_InMemoryDbConnectionInfo connectInfo();
+		connectInfo.m_sDatabaseName = "SaveDataPoolTests";
+		persistenceManager.SetDbContext(EDF_DbContext.Create(connectInfo));
+
+		m_bPreviousPoolEnabled = EPF_SaveDataPool.IsEnabled();
+		EPF_SaveDataPool.SetEnabled(true);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.TearDown)]
+	void TearDown()
+	{
+		if (!m_bPreviousPoolEnabled)
+			EPF_SaveDataPool.Reset();
+
+		EPF_PersistenceManager.GetInstance().SetDbContext(m_pPreviousContext);
+		m_pPreviousContext = null;
+	}
+}
+
+class EPF_Test_SaveDataPoolBase : TestBase
+{
+	protected static const string PREFAB = "{C95E11C60810F432}Prefabs/Items/Core/Item_Base.et";
+
+	//------------------------------------------------------------------------------------------------
+	protected EPF_EntitySaveData CreateSaveData()
+	{
+		EPF_EntitySaveData saveData = EPF_SaveDataPool.GetEntitySaveData(EPF_ItemSaveData);
+		saveData.m_rPrefab = PREFAB;
+		saveData.SetId(EPF_PersistenceIdGenerator.Generate());
+		return saveData;
+	}
+
+	//------------------------------------------------------------------------------------------------
+	//! Recycled instances have their prefab cleared and are handed out again by the pool
+	protected bool IsRecycled(EPF_EntitySaveData saveData)
+	{
+		return !saveData.m_rPrefab && EPF_SaveDataPool.GetEntitySaveData(EPF_ItemSaveData) == saveData;
+	}
+}
+
+[Test("EPF_SaveDataPoolTests", 3)]
+class EPF_Test_SaveDataPool_Release_PendingWrite_RecycledAfterCallback : EPF_Test_SaveDataPoolBase
+{
+	ref EPF_EntitySaveData m_pSaveData;
+	bool m_bKeptWhilePending;
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	void Act()
+	{
+		m_pSaveData = CreateSaveData();
+		EPF_PersistenceManager.GetInstance().AddOrUpdateAsync(m_pSaveData);
+
+		// The save operation is done with it, but the database might not be
+		EPF_SaveDataPool.Release(m_pSaveData);
+		m_bKeptWhilePending = m_pSaveData.m_rPrefab == PREFAB &&
+			EPF_BitFlags.CheckFlags(m_pSaveData.m_ePoolFlags, EPF_ESaveDataPoolFlags.PENDING_WRITE);
+
+		GetGame().GetCallqueue().CallLater(Assert, 100);
+	}
+
+	//------------------------------------------------------------------------------------------------
+	void Assert()
+	{
+		SetResult(new EDF_TestResult(m_bKeptWhilePending && IsRecycled(m_pSaveData)));
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	bool AwaitResult()
+	{
+		return GetResult();
+	}
+
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.TearDown)]
+	void Cleanup()
+	{
+		m_pSaveData = null;
+	}
+}
+
+[Test("EPF_SaveDataPoolTests")]
+class EPF_Test_SaveDataPool_Release_SharedOrRetained_NeverPooled : EPF_Test_SaveDataPoolBase
+{
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	void ActAndAssert()
+	{
+		EPF_EntitySaveData shared = CreateSaveData();
+		EPF_SaveDataPool.Share(shared);
+
+		EPF_EntitySaveData retained = CreateSaveData();
+		EPF_SaveDataPool.Retain(retained);
+
+		EPF_EntitySaveData unretained = CreateSaveData();
+		EPF_SaveDataPool.Retain(unretained);
+		EPF_SaveDataPool.Unretain(unretained);
+
+		// Act
+		EPF_SaveDataPool.Release(shared);
+		EPF_SaveDataPool.Release(retained);
+
+		// Assert
+		bool sharedKept = shared.m_rPrefab == PREFAB && !IsRecycled(shared);
+		bool retainedKept = retained.m_rPrefab == PREFAB && !IsRecycled(retained);
+
+		// Unretain alone must not release it, as other save-data might still reference it
+		bool unretainedKept = unretained.m_rPrefab == PREFAB;
+
+		SetResult(new EDF_TestResult(sharedKept && retainedKept && unretainedKept));
+	}
+}
+
+[Test("EPF_SaveDataPoolTests")]
+class EPF_Test_SaveDataPool_Release_NestedSlotsAndGroups_FullyReset : EPF_Test_SaveDataPoolBase
+{
+	//------------------------------------------------------------------------------------------------
+	[Step(EStage.Main)]
+	void ActAndAssert()
+	{
+		EPF_EntitySaveData root = CreateSaveData();
+		EPF_EntitySaveData slotItem = CreateSaveData();
+		EPF_EntitySaveData groupItem = CreateSaveData();
+
+		EPF_BaseInventoryStorageComponentSaveData storage = EPF_BaseInventoryStorageComponentSaveData.Cast(
+			EPF_SaveDataPool.Get(EPF_BaseInventoryStorageComponentSaveData));
+
+		EPF_PersistentInventoryStorageSlot slot = EPF_PersistentInventoryStorageSlot.Cast(EPF_SaveDataPool.Get(EPF_PersistentInventoryStorageSlot));
+		slot.m_iSlotIndex = 0;
+		slot.m_pEntity = slotItem;
+		storage.m_aSlots = {slot};
+
+		EPF_PersistentInventoryStorageSlotGroup slotGroup = EPF_PersistentInventoryStorageSlotGroup.Cast(EPF_SaveDataPool.Get(EPF_PersistentInventoryStorageSlotGroup));
+		slotGroup.m_aSlotIndices = {1, 2};
+		slotGroup.m_aIds = {groupItem.GetId(), EPF_PersistenceIdGenerator.Generate()};
+		slotGroup.m_pEntity = groupItem;
+		storage.m_aSlotGroups = {slotGroup};
+
+		EPF_PersistentComponentSaveData persistentComponent();
+		persistentComponent.m_pData = storage;
+		root.m_aComponents = {persistentComponent};
+
+		// Act
+		EPF_SaveDataPool.Release(root);
+
+		// Assert
+		bool rootReset = !root.m_rPrefab && root.m_aComponents.IsEmpty() && !persistentComponent.m_pData;
+		bool storageReset = storage.m_aSlots.IsEmpty() && storage.m_aSlotGroups.IsEmpty();
+		bool slotReset = !slot.m_pEntity;
+		bool slotGroupReset = !slotGroup.m_pEntity && slotGroup.m_aSlotIndices.IsEmpty() && slotGroup.m_aIds.IsEmpty();
+		bool nestedReset = !slotItem.m_rPrefab && !groupItem.m_rPrefab;
+
+		// The helpers are handed out again for the next save
+		bool helpersPooled = EPF_SaveDataPool.Get(EPF_PersistentInventoryStorageSlotGroup) == slotGroup &&
+			EPF_SaveDataPool.Get(EPF_BaseInventoryStorageComponentSaveData) == storage;
+
+		SetResult(new EDF_TestResult(rootReset && storageReset && slotReset && slotGroupReset && nestedReset && helpersPooled));
+	}
+}